@@ -9,6 +9,8 @@
 #include "layout/LayoutParser.h"
 #include "layout/LayoutBackend.h"
 #include "utils/ResourceUtils.h"
+#include "utils/EncodingUtils.h"
+#include "utils/Profiler.h"
 #include "layout/model/TokenData.h"
 #include "ui/WindowPanel.h"
 #include "ui/PropertyPanel.h"
@@ -25,6 +27,37 @@
 #include <QDebug>
 #include <QTimer>
 #include <QMessageBox>
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <atomic>
+
+// --------------------------------------------------
+// Zustand eines asynchronen Ladevorgangs
+// --------------------------------------------------
+// Gehört gemeinsam dem GUI-Thread und den Worker-Tasks. Die Worker
+// schreiben nur in die Ergebnisfelder ihres eigenen Zweigs; gelesen
+// wird erst nach Abschluss (QFutureWatcher::finished, GUI-Thread).
+// --------------------------------------------------
+struct ProjectController::AsyncLoadState
+{
+    static constexpr int kStageCount = 10;
+
+    std::atomic<bool> cancel { false };
+    std::atomic<int>  done   { 0 };
+
+    QString cfgFile;
+    QString resdataFile;
+    QString iconDir;
+    QString sourceDir;
+    QString themeName;
+
+    // Ergebnisse
+    QMap<QString, QColor>     gameColors;
+    LayoutManager::WindowList windows;
+    QMap<QString, QImage>     icons;
+    ThemeManager::ThemeImages theme;
+    bool                      layoutDone = false;
+};
 
 // --------------------------------------------------
 // Konstruktor
@@ -72,31 +105,48 @@ ProjectController::ProjectController(QObject* parent)
     connect(m_layoutManager.get(), &LayoutManager::tokensReady,
             this, &ProjectController::onTokensReady);
 
+    // Asynchrones Laden abgeschlossen → Übernahme im GUI-Thread
+    connect(&m_loadWatcher, &QFutureWatcher<void>::finished,
+            this, &ProjectController::onAsyncLoadFinished);
+
     qInfo() << "[ProjectController] Modernisiert initialisiert.";
 }
 
+ProjectController::~ProjectController()
+{
+    // Laufende Worker greifen auf die Manager zu → abbrechen und warten
+    cancelLoad();
+    m_loadWatcher.waitForFinished();
+}
+
 void ProjectController::onTokensReady()
 {
-    qInfo() << "[ProjectController] TokensReady empfangen -> Rebuild Define/Text Manager";
+    // Beim asynchronen Laden kommt das Signal verzögert (queued) aus dem
+    // Worker; der Rebuild ist dort bereits in der richtigen Reihenfolge gelaufen.
+    if (m_asyncLoad)
+        return;
 
-    m_tokensReady = true;
+    qInfo() << "[ProjectController] TokensReady empfangen -> Rebuild Define/Text Manager";
+    rebuildTokenManagers();
+}
 
-    // 1) Alle Tokens flach sammeln (Define/Text Manager brauchen die Listen)
-    const auto tokenMap = TokenData::instance().all();   // QMap<QString, QList<Token>>
+void ProjectController::rebuildTokenManagers()
+{
+    FLYFF_PROFILE_SCOPE("tokenRebuild", "load");
 
-    QList<Token> flatTokens;
-    flatTokens.reserve(20000);
+    m_tokensReady = true;
 
-    for (const auto& list : tokenMap)
-        flatTokens.append(list);
+    // 1) Snapshot holen (keine Kopie; Define/Text Manager iterieren die Fensterlisten selbst)
+    const TokenSnapshot snapshot = TokenData::instance().snapshot();
+    const TokenStore& store = *snapshot;
 
     // 2) DefineManager: nur REBUILD – kein apply!
     if (m_defineManager)
-        m_defineManager->rebuildFromTokens(flatTokens);
+        m_defineManager->rebuildFromTokens(store);
 
     // 3) TextManager: nur REBUILD – kein apply!
     if (m_textManager)
-        m_textManager->rebuildFromTokens(flatTokens);
+        m_textManager->rebuildFromTokens(store);
 
     // 4) LayoutManager kümmert sich danach selbst um Behavior etc.
     //    (Apply passiert später in loadProject(), wenn Layout vollständig vorliegt)
@@ -109,12 +159,94 @@ void ProjectController::onTokensReady()
 bool ProjectController::loadProject(const QString& configPath)
 {
     qInfo() << "[ProjectController] Starte Projekt-Ladevorgang...";
+    if (m_loadingActive) {
+        qWarning() << "[ProjectController] Ladevorgang läuft bereits.";
+        return false;
+    }
+
     m_loadingActive = true;
     m_tokensReady = false;
 
-    const QString cfgFile = configPath.isEmpty()
-                                ? ConfigManager::defaultConfigPath()
-                                : configPath;
+    FLYFF_PROFILE_SCOPE("loadProject", "load");
+    FLYFF_PROFILE_STAGES(stage, "load");
+
+    QString cfgFile;
+    FLYFF_PROFILE_NEXT(stage, "config");
+    if (!prepareConfig(configPath, cfgFile)) {
+        m_loadingActive = false;
+        return false;
+    }
+
+    const QString resdataFile = m_configManager->layoutPath();
+    const QString iconDir     = m_configManager->iconPath();
+    const QString sourceDir   = m_configManager->sourcePath();
+
+    FLYFF_PROFILE_NEXT(stage, "colors");
+    loadGameColors(sourceDir);
+
+    FLYFF_PROFILE_NEXT(stage, "flags");
+    prepareFlags(cfgFile, sourceDir);
+
+    // ---------------------------------------------------
+    // 3) BehaviorManager Flags einlesen
+    // ---------------------------------------------------
+    m_behaviorManager->refreshFlagsFromFiles();
+
+    // ---------------------------------------------------
+    // 4) Layout laden
+    // ---------------------------------------------------
+    FLYFF_PROFILE_NEXT(stage, "tokenize");
+    m_layoutBackend->setPath(resdataFile);
+    m_layoutBackend->load();                      // Tokens generieren
+    FLYFF_PROFILE_NEXT(stage, "refreshFromParser");
+    m_layoutManager->refreshFromParser();         // Tokens → Raw Layout
+    FLYFF_PROFILE_NEXT(stage, "processLayout");
+    m_layoutManager->processLayout();             // Behavior wird HIER angewendet!
+    FLYFF_PROFILE_FINISH(stage);
+
+    emit layoutsReady();
+
+    const auto& windows = m_layoutManager->processedWindows();
+    qInfo() << "[ProjectController] Processed Layouts:" << windows.size();
+    FLYFF_PROFILE_COUNTER("windows", qint64(windows.size()));
+
+    // ---------------------------------------------------
+    // 5) Defines + Texte anwenden
+    // ---------------------------------------------------
+    FLYFF_PROFILE_NEXT(stage, "defineTextApply");
+    loadDefineTextFiles(resdataFile);
+
+    m_defineManager->applyDefinesToLayout(windows);
+    m_textManager->applyTextsToLayout(windows);
+
+    // ---------------------------------------------------
+    // 6) Ressourcen laden
+    // ---------------------------------------------------
+    FLYFF_PROFILE_NEXT(stage, "icons");
+    m_icons = ResourceUtils::loadIcons(iconDir);
+
+    FLYFF_PROFILE_NEXT(stage, "theme");
+
+    const QString themeName = defaultThemeName();
+    qInfo().noquote() << "[ProjectController] Lade Theme:" << themeName;
+    m_themeManager->loadTheme(themeName);
+
+    // ---------------------------------------------------
+    // 7) Projekt finalisieren
+    // ---------------------------------------------------
+    FLYFF_PROFILE_FINISH(stage);
+    finishLoad();
+    return true;
+}
+
+// --------------------------------------------------
+// 0) + 1) Config initial erzeugen (Dialoge) und laden – GUI-Thread
+// --------------------------------------------------
+bool ProjectController::prepareConfig(const QString& configPath, QString& cfgFile)
+{
+    cfgFile = configPath.isEmpty()
+                  ? ConfigManager::defaultConfigPath()
+                  : configPath;
 
     // ---------------------------------------------------
     // 0) Config initial erzeugen falls nicht vorhanden
@@ -156,18 +288,23 @@ bool ProjectController::loadProject(const QString& configPath)
         return false;
     }
 
-    const QString resdataFile = m_configManager->layoutPath();
-    m_fileManager->cacheLayoutPath(resdataFile);
-
-    const QString themeDir  = m_configManager->themePath();
-    const QString iconDir   = m_configManager->iconPath();
-    const QString sourceDir = m_configManager->sourcePath();
+    m_fileManager->cacheLayoutPath(m_configManager->layoutPath());
+    return true;
+}
 
-    // ---------------------------------------------------
-    // 1b) Game-Source-Farben extrahieren  ← HIER EINSETZEN
-    // ---------------------------------------------------
+// --------------------------------------------------
+// 1b) Game-Source-Farben extrahieren
+// --------------------------------------------------
+void ProjectController::loadGameColors(const QString& sourceDir)
+{
     qInfo() << "[ProjectController] Extrahiere Farben aus Game-Source...";
-    if (!m_themeManager->loadGameSourceColors(sourceDir)) {
+    applyGameColors(ThemeManager::extractGameSourceColors(sourceDir));
+}
+
+// Übernahme der extrahierten Farben – GUI-Thread
+void ProjectController::applyGameColors(const QMap<QString, QColor>& extracted)
+{
+    if (!m_themeManager->adoptGameSourceColors(extracted)) {
         qWarning() << "[ProjectController] WARNUNG: Konnte Game-Source-Farben nicht extrahieren!";
     } else {
         qInfo() << "[ProjectController] Game-Source-Farben erfolgreich geladen:"
@@ -180,7 +317,7 @@ bool ProjectController::loadProject(const QString& configPath)
     {
         qInfo() << "[ProjectController] ui_colors.json nicht gefunden → speichere extrahierte Farben";
 
-        // Farben stammen aus dem bereits erfolgten loadGameSourceColors-Aufruf:
+        // Farben stammen aus dem bereits erfolgten adoptGameSourceColors-Aufruf:
         const QMap<QString, QColor>& extracted =
             m_themeManager->processedColors().colors;
 
@@ -196,9 +333,13 @@ bool ProjectController::loadProject(const QString& configPath)
     gProcessedColors.loadFromJson(uiColorPath);
 
     qInfo() << "[ProjectController] UI-Farben geladen aus:" << uiColorPath;
-    // ---------------------------------------------------
-    // 2) Flags generieren falls nötig
-    // ---------------------------------------------------
+}
+
+// --------------------------------------------------
+// 2) Flags generieren falls nötig
+// --------------------------------------------------
+void ProjectController::prepareFlags(const QString& cfgFile, const QString& sourceDir)
+{
     const QString configDir = QFileInfo(cfgFile).absolutePath();
     const QString wndFlagsPath  = configDir + "/window_flags.json";
     const QString ctrlFlagsPath = configDir + "/control_flags.json";
@@ -222,28 +363,13 @@ bool ProjectController::loadProject(const QString& configPath)
                                       m_flagManager->controlFlags());
         m_flagManager->extendFlagGroups(configDir + "/flag_groups.json");
     }
+}
 
-    // ---------------------------------------------------
-    // 3) BehaviorManager Flags einlesen
-    // ---------------------------------------------------
-    m_behaviorManager->refreshFlagsFromFiles();
-
-    // ---------------------------------------------------
-    // 4) Layout laden
-    // ---------------------------------------------------
-    m_layoutBackend->setPath(resdataFile);
-    m_layoutBackend->load();                      // Tokens generieren
-    m_layoutManager->refreshFromParser();         // Tokens → Raw Layout
-    m_layoutManager->processLayout();             // Behavior wird HIER angewendet!
-
-    emit layoutsReady();
-
-    auto windows = m_layoutManager->processedWindows();
-    qInfo() << "[ProjectController] Processed Layouts:" << windows.size();
-
-    // ---------------------------------------------------
-    // 5) Defines + Texte anwenden
-    // ---------------------------------------------------
+// --------------------------------------------------
+// 5) Define-/Textdateien einlesen (setzt den Token-Rebuild voraus)
+// --------------------------------------------------
+void ProjectController::loadDefineTextFiles(const QString& resdataFile)
+{
     const QString defineFile  = m_fileManager->findDefineFile(resdataFile);
     const QString textFile    = m_fileManager->findTextFile(resdataFile);
     const QString textIncFile = m_fileManager->findTextIncFile(resdataFile);
@@ -256,27 +382,23 @@ bool ProjectController::loadProject(const QString& configPath)
 
     if (!textIncFile.isEmpty())
         m_textBackend->loadInc(textIncFile, *m_textManager);
+}
 
-    m_defineManager->applyDefinesToLayout(windows);
-    m_textManager->applyTextsToLayout(windows);
-
-    // ---------------------------------------------------
-    // 6) Ressourcen laden
-    // ---------------------------------------------------
-    m_icons = ResourceUtils::loadIcons(iconDir);
-
-    QString defaultTheme = "Default";
+QString ProjectController::defaultThemeName() const
+{
     if (QDir(m_fileManager->themeFolderPath("English")).exists())
-        defaultTheme = "English";
-
-    qInfo().noquote() << "[ProjectController] Lade Theme:" << defaultTheme;
-    m_themeManager->loadTheme(defaultTheme);
+        return "English";
+    return "Default";
+}
 
-    // ---------------------------------------------------
-    // 7) Projekt finalisieren
-    // ---------------------------------------------------
+// --------------------------------------------------
+// 7) Projekt finalisieren – GUI-Thread
+// --------------------------------------------------
+void ProjectController::finishLoad()
+{
     emit projectLoaded();
 
+    auto windows = m_layoutManager->processedWindows();
     QTimer::singleShot(0, this, [this, windows]() {
         if (!windows.empty() && windows.front()) {
             emit windowsReady(windows);
@@ -285,15 +407,222 @@ bool ProjectController::loadProject(const QString& configPath)
     });
 
     m_loadingActive = false;
+}
+
+// --------------------------------------------------
+// Projekt asynchron laden
+// --------------------------------------------------
+// Abhängigkeiten der Stufen:
+//
+//   Ressourcen:  colors → icons → theme (nur QMap/QImage)
+//   Layout:      flags → tokenize → tokenRebuild ─┬→ windows → process ─┬→ apply
+//   Dateien:                                      └→ define/text ────────┘
+//
+// Ressourcen- und Layoutzweig laufen parallel, Define-/Textdateien
+// parallel zu Fensteraufbau und Behavior-Verarbeitung. Die Worker
+// bauen nur vor (Fensterliste, QImages); Übernahme in den
+// LayoutManager, QPixmap/QIcon-Erzeugung und alle UI-Signale
+// passieren in onAsyncLoadFinished() im GUI-Thread.
+//
+// Während des Ladens dürfen GUI-seitig keine Manager verändert
+// werden (m_loadingActive sperrt Auswahl und Speichern).
+// --------------------------------------------------
+bool ProjectController::loadProjectAsync(const QString& configPath)
+{
+    qInfo() << "[ProjectController] Starte asynchronen Projekt-Ladevorgang...";
+    if (m_loadingActive) {
+        qWarning() << "[ProjectController] Ladevorgang läuft bereits.";
+        return false;
+    }
+
+    m_loadingActive = true;
+    m_tokensReady = false;
+
+    auto state = std::make_shared<AsyncLoadState>();
+    if (!prepareConfig(configPath, state->cfgFile)) {
+        m_loadingActive = false;
+        return false;
+    }
+
+    state->resdataFile = m_configManager->layoutPath();
+    state->iconDir     = m_configManager->iconPath();
+    state->sourceDir   = m_configManager->sourcePath();
+    state->themeName   = defaultThemeName();
+
+    // Alte Auswahl gehört zum vorherigen Projekt; Canvas soll während
+    // des Ladens nichts aus den Managern zeichnen
+    m_currentWindow.reset();
+    m_currentControl.reset();
+    emit activeWindowChanged(nullptr);
+
+    m_asyncLoad = state;
+    m_loadWatcher.setFuture(QtConcurrent::run([this, state]() {
+        runAsyncLoad(*state);
+    }));
+
     return true;
 }
 
+void ProjectController::cancelLoad()
+{
+    if (!m_asyncLoad)
+        return;
+
+    qInfo() << "[ProjectController] Ladevorgang wird abgebrochen...";
+    m_asyncLoad->cancel.store(true, std::memory_order_relaxed);
+}
+
+// Stufe abschließen + Fortschritt melden; false = abgebrochen
+bool ProjectController::finishStage(AsyncLoadState& state, const char* stage)
+{
+    const int done = ++state.done;
+    emit loadProgress(QString::fromLatin1(stage), done, AsyncLoadState::kStageCount);
+    return !state.cancel.load(std::memory_order_relaxed);
+}
+
+void ProjectController::runAsyncLoad(AsyncLoadState& state)
+{
+    FLYFF_PROFILE_SCOPE("loadProjectAsync", "load");
+
+    // ---------------------------------------------------
+    // Ressourcenzweig (unabhängig vom Layout)
+    // ---------------------------------------------------
+    QFuture<void> resources = QtConcurrent::run([this, &state]() {
+        {
+            FLYFF_PROFILE_SCOPE("colors", "load");
+            state.gameColors = ThemeManager::extractGameSourceColors(state.sourceDir);
+        }
+        if (!finishStage(state, "colors"))
+            return;
+
+        {
+            FLYFF_PROFILE_SCOPE("icons", "load");
+            state.icons = ResourceUtils::loadIconImages(state.iconDir);
+        }
+        if (!finishStage(state, "icons"))
+            return;
+
+        {
+            FLYFF_PROFILE_SCOPE("theme", "load");
+            state.theme = m_themeManager->decodeTheme(state.themeName);
+        }
+        finishStage(state, "theme");
+    });
+
+    // ---------------------------------------------------
+    // Layoutzweig (in diesem Task)
+    // ---------------------------------------------------
+    auto layoutBranch = [this, &state]() {
+        {
+            FLYFF_PROFILE_SCOPE("flags", "load");
+            prepareFlags(state.cfgFile, state.sourceDir);
+            m_behaviorManager->refreshFlagsFromFiles();
+        }
+        if (!finishStage(state, "flags"))
+            return;
+
+        {
+            FLYFF_PROFILE_SCOPE("tokenize", "load");
+            m_layoutBackend->setPath(state.resdataFile);
+            m_layoutBackend->load();
+        }
+        if (!finishStage(state, "tokenize"))
+            return;
+
+        rebuildTokenManagers();
+        if (!finishStage(state, "tokenRebuild"))
+            return;
+
+        // Define-/Textdateien brauchen nur den Token-Rebuild
+        QFuture<void> files = QtConcurrent::run([this, &state]() {
+            {
+                FLYFF_PROFILE_SCOPE("defineText", "load");
+                loadDefineTextFiles(state.resdataFile);
+            }
+            finishStage(state, "defineText");
+        });
+
+        bool ok = true;
+        {
+            FLYFF_PROFILE_SCOPE("refreshFromParser", "load");
+            const TokenSnapshot snapshot = TokenData::instance().snapshot();
+            state.windows = m_layoutManager->buildWindows(*snapshot);
+        }
+        ok = finishStage(state, "refreshFromParser");
+
+        if (ok) {
+            FLYFF_PROFILE_SCOPE("processLayout", "load");
+            m_layoutManager->processWindows(state.windows);
+            ok = finishStage(state, "processLayout");
+        }
+
+        files.waitForFinished();
+        if (!ok || state.cancel.load(std::memory_order_relaxed))
+            return;
+
+        {
+            FLYFF_PROFILE_SCOPE("defineTextApply", "load");
+            m_defineManager->applyDefinesToLayout(state.windows);
+            m_textManager->applyTextsToLayout(state.windows);
+        }
+        state.layoutDone = finishStage(state, "defineTextApply");
+    };
+
+    layoutBranch();
+    resources.waitForFinished();
+}
+
+// --------------------------------------------------
+// Asynchrones Laden abgeschlossen – Übernahme im GUI-Thread
+// --------------------------------------------------
+void ProjectController::onAsyncLoadFinished()
+{
+    std::shared_ptr<AsyncLoadState> state = std::move(m_asyncLoad);
+    if (!state)
+        return;
+
+    if (state->cancel.load(std::memory_order_relaxed) || !state->layoutDone)
+    {
+        // Tokens/Define/Text sind evtl. schon halb neu → Projekt verwerfen
+        m_layoutManager->adoptWindows({});
+        m_loadingActive = false;
+
+        qWarning() << "[ProjectController] Ladevorgang abgebrochen.";
+        emit loadFinished(false);
+        return;
+    }
+
+    FLYFF_PROFILE_SCOPE("adoptAsyncLoad", "load");
+
+    m_layoutManager->adoptWindows(std::move(state->windows));
+    emit layoutsReady();
+
+    qInfo() << "[ProjectController] Processed Layouts:"
+            << m_layoutManager->processedWindows().size();
+    FLYFF_PROFILE_COUNTER("windows", qint64(m_layoutManager->processedWindows().size()));
+
+    m_icons = ResourceUtils::iconsFromImages(state->icons);
+
+    applyGameColors(state->gameColors);
+
+    qInfo().noquote() << "[ProjectController] Lade Theme:" << state->themeName;
+    m_themeManager->adoptTheme(state->theme);
+
+    finishLoad();
+    emit loadFinished(true);
+}
+
 
 // --------------------------------------------------
 // Projekt speichern
 // --------------------------------------------------
 bool ProjectController::saveProject()
 {
+    if (m_loadingActive) {
+        qWarning() << "[ProjectController] Speichern während des Ladens nicht möglich.";
+        return false;
+    }
+
     // ----------------------------------------------------------
     // Sicherheit: Prüfen, ob alles da ist
     // ----------------------------------------------------------
@@ -327,10 +656,16 @@ bool ProjectController::saveProject()
     // ----------------------------------------------------------
     // 1️⃣ Layout speichern
     // ----------------------------------------------------------
-    QString layoutContent = m_layoutManager->serializeLayout();
-    if (!m_layoutBackend->writeFile(layoutPath, layoutContent)) {
-        qWarning() << "[ProjectController] Layout speichern fehlgeschlagen!";
-        return false;
+    // Nur geänderte Fenster werden neu serialisiert und fensterweise
+    // in eine temporäre Datei gestreamt; erst commit() ersetzt das Ziel
+    {
+        EncodingUtils::TextFileWriter writer(layoutPath);
+        writer.open({ QStringConverter::Utf16LE, 2, "UTF-16 LE (Vorgabe):" });
+        m_layoutManager->writeLayout(writer);
+        if (!writer.commit()) {
+            qWarning() << "[ProjectController] Layout speichern fehlgeschlagen!";
+            return false;
+        }
     }
 
     // ----------------------------------------------------------
@@ -391,7 +726,7 @@ bool ProjectController::saveProject()
 
 void ProjectController::selectWindow(const QString& windowName)
 {
-    if (!m_layoutManager)
+    if (!m_layoutManager || m_loadingActive)
         return;
 
     auto wnd = m_layoutManager->findWindow(windowName);
@@ -409,23 +744,14 @@ void ProjectController::selectWindow(const QString& windowName)
 
 void ProjectController::selectControl(const QString& windowName, const QString& controlName)
 {
-    if (!m_layoutManager)
+    if (!m_layoutManager || m_loadingActive)
         return;
 
     auto wnd = m_layoutManager->findWindow(windowName);
     if (!wnd)
         return;
 
-    std::shared_ptr<ControlData> foundCtrl;
-    for (const auto& ctrl : wnd->controls)
-    {
-        if (ctrl && ctrl->id == controlName)
-        {
-            foundCtrl = ctrl;
-            break;
-        }
-    }
-
+    auto foundCtrl = m_layoutManager->findControl(windowName, controlName);
     if (!foundCtrl)
         return;
 
@@ -542,6 +868,8 @@ void ProjectController::bindPanels(WindowPanel* windowPanel, PropertyPanel* prop
 
                     // Konsistent: BehaviorManager darf noch zusätzliche Dinge tun
                     m_behaviorManager->updateControlFlags(ctrl);
+                    if (m_layoutManager)
+                        m_layoutManager->markWindowDirty(wnd);
 
                     qInfo() << "[ProjectController] Control flags aktualisiert für" << ctrl->id;
                 }
@@ -555,6 +883,8 @@ void ProjectController::bindPanels(WindowPanel* windowPanel, PropertyPanel* prop
                     }
 
                     m_behaviorManager->updateWindowFlags(wnd);
+                    if (m_layoutManager)
+                        m_layoutManager->markWindowDirty(wnd);
 
                     qInfo() << "[ProjectController] Window flags aktualisiert für" << wnd->name;
                 }
@@ -604,6 +934,9 @@ void ProjectController::toggleControlFlag(const QString& flagName, bool enabled)
             ctrl->resolvedMask << it.key();
     }
 
+    if (m_layoutManager)
+        m_layoutManager->markWindowDirty(currentWindow());
+
     qInfo().noquote() << QString("[ProjectController] Control flags aktualisiert für \"%1\"")
                              .arg(ctrl->id);
 
@@ -627,6 +960,9 @@ void ProjectController::toggleWindowFlag(const QString& flag, bool enable)
 
     m_behaviorManager->updateWindowFlags(m_currentWindow);
 
+    if (m_layoutManager)
+        m_layoutManager->markWindowDirty(m_currentWindow);
+
     emit uiRefreshRequested();
 }
 
@@ -643,9 +979,14 @@ std::shared_ptr<WindowData> ProjectController::findWindow(const QString& name) c
 std::shared_ptr<ControlData> ProjectController::findControl(const QString& id) const
 {
     auto wnd = currentWindow();
-    if (!wnd)
+    auto lm  = layoutManager();
+    if (!wnd || !lm)
         return nullptr;
 
+    // Index liefert nur Controls des indizierten Fensters gleichen Namens
+    if (lm->findWindow(wnd->name) == wnd)
+        return lm->findControl(wnd->name, id);
+
     for (const auto& ctrl : wnd->controls) {
         if (ctrl && ctrl->id == id)
             return ctrl;
@@ -696,6 +1037,7 @@ void ProjectController::updateWindowFlags(const QString& windowName, quint32 mas
 
     // BehaviorManager aktualisiert ggf. weitere abgeleitete Infos
     m_behaviorManager->updateWindowFlags(wnd);
+    m_layoutManager->markWindowDirty(wnd);
 
     qInfo().noquote() << QString("[ProjectController] Window '%1' Flags aktualisiert → %2 (%3)")
                              .arg(windowName)
@@ -742,6 +1084,7 @@ void ProjectController::updateControlFlags(const QString& controlId, quint32 mas
 
     // BehaviorManager baut resolvedMask neu auf / ergänzt
     m_behaviorManager->updateControlFlags(ctrl);
+    m_layoutManager->markWindowDirty(currentWindow());
 
     qInfo().noquote() << QString("[ProjectController] Control '%1' Flags aktualisiert → %2 (%3)")
                              .arg(controlId)
@@ -7,6 +7,7 @@
 #include <QPixmap>
 #include <QString>
 #include <QDebug>
+#include <QFutureWatcher>
 
 #include "WindowData.h"
 #include "ConfigManager.h"
@@ -35,6 +36,7 @@ class ProjectController : public QObject
 
 public:
     explicit ProjectController(QObject* parent = nullptr);
+    ~ProjectController() override;
 
     // ---- Canvas Binding (neu) ----
     void bindCanvas(Canvas* canvas);
@@ -45,6 +47,12 @@ public:
     bool loadProject(const QString& configPath);
     bool saveProject();
 
+    // Asynchrones Laden: Dialoge + Config im GUI-Thread, alles Weitere
+    // auf dem Threadpool; Ergebnis über loadFinished()
+    bool loadProjectAsync(const QString& configPath);
+    void cancelLoad();
+    bool isLoading() const { return m_loadingActive; }
+
     LayoutManager* layoutManager() const { return m_layoutManager.get(); }
     TextManager* textManager() const { return m_textManager.get(); }
     BehaviorManager* behaviorManager() const { return m_behaviorManager.get(); }
@@ -74,12 +82,17 @@ signals:
     void selectionChanged();
     void uiRefreshRequested();
 
+    // Fortschritt des asynchronen Ladens (aus Worker-Threads gesendet)
+    void loadProgress(const QString& stage, int done, int total);
+    void loadFinished(bool success);
+
 public slots:
     void selectWindow(const QString& windowName);
     void selectControl(const QString& windowName, const QString& controlName);
 
 private slots:
     void onTokensReady();
+    void onAsyncLoadFinished();
 
 private:
     // !!! Alle deine bestehenden Manager bleiben !!!
@@ -112,6 +125,24 @@ private:
     std::shared_ptr<WindowData> findWindow(const QString& name) const;
     std::shared_ptr<ControlData> findControl(const QString& id) const;
 
+    // Gemeinsame Ladeschritte (sync + async)
+    bool prepareConfig(const QString& configPath, QString& cfgFile);
+    void loadGameColors(const QString& sourceDir);
+    void applyGameColors(const QMap<QString, QColor>& extracted);
+    void prepareFlags(const QString& cfgFile, const QString& sourceDir);
+    void rebuildTokenManagers();
+    void loadDefineTextFiles(const QString& resdataFile);
+    QString defaultThemeName() const;
+    void finishLoad();
+
+    // Asynchrones Laden
+    struct AsyncLoadState;
+    void runAsyncLoad(AsyncLoadState& state);
+    bool finishStage(AsyncLoadState& state, const char* stage);
+
+    std::shared_ptr<AsyncLoadState> m_asyncLoad;
+    QFutureWatcher<void>            m_loadWatcher;
+
     bool m_loadingActive = false;
     bool m_tokensReady = false;
 };
@@ -1,7 +1,9 @@
 #include <QApplication>
 #include <QDebug>
+#include <QStatusBar>
 #include "core/ProjectController.h"
 #include "ui/MainWindow.h"
+#include "utils/Profiler.h"
 
 int main(int argc, char *argv[])
 {
@@ -23,20 +25,46 @@ int main(int argc, char *argv[])
         fprintf(stderr, "%s\n", localMsg.constData());
     });
 
+    // Profiling: FLYFF_TRACE=<datei.json> → Chrome-Trace beim Beenden
+    const QString tracePath = qEnvironmentVariable("FLYFF_TRACE");
+    if (!tracePath.isEmpty()) {
+        Profiler::setEnabled(true);
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, [tracePath]() {
+            Profiler::writeChromeTrace(tracePath);
+        });
+    }
+
     ProjectController controller;
     MainWindow window(&controller);
     window.show();
     qDebug() << "[Main] MainWindow erfolgreich erstellt.";
 
-    // Projekt laden
-    if (!controller.loadProject("")) {
+    // Fortschritt in der Statusleiste
+    QObject::connect(&controller, &ProjectController::loadProgress, &window,
+                     [&window](const QString& stage, int done, int total) {
+        window.statusBar()->showMessage(
+            QString("Lade Projekt: %1 (%2/%3)").arg(stage).arg(done).arg(total));
+    });
+
+    // Panels erst nach dem Laden verbinden!
+    QObject::connect(&controller, &ProjectController::loadFinished, &window,
+                     [&window](bool success) {
+        if (!success) {
+            qWarning() << "[Main] Projekt konnte nicht geladen werden.";
+            QCoreApplication::exit(1);
+            return;
+        }
+
+        window.statusBar()->clearMessage();
+        window.initializeAfterLoad();
+    }, Qt::SingleShotConnection);
+
+    // Projekt asynchron laden (Fenster bleibt bedienbar)
+    if (!controller.loadProjectAsync("")) {
         qWarning() << "[Main] Projekt konnte nicht geladen werden.";
         return 1;
     }
 
-    // Panels erst jetzt verbinden!
-    window.initializeAfterLoad();
-
     qDebug() << "[Main] Event-Loop gestartet.";
     return app.exec();
 }
@@ -39,7 +39,6 @@ struct ControlData
     // --- Debug / Metadaten ---
     int sourceLine = 0;      // Zeilennummer in der Layoutdatei
     QString rawHeader;       // ursprüngliche Textzeile
-    QStringList tokens;      // Tokenliste zur Analyse
     bool valid = false;
 
     quint32 flagsMask = 0;             // Effektive Bitmaske
@@ -1,26 +1,163 @@
 #pragma once
 #include <QString>
+#include <QStringView>
 #include <QList>
 #include <QMap>
-#include <mutex>
+#include <QHashFunctions>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
 
 // ------------------------------------------------------------
-// Token-Struktur
+// Token-Art (ersetzt den früheren QString-Typ)
+// ------------------------------------------------------------
+enum class TokenKind : quint8 {
+    WindowHeader,
+    ControlHeader,
+    Text,
+    Comment,
+    Define,
+    Other
+};
+
+// Index in die Symboltabelle eines TokenStore (0 = leer)
+using TokenSymbol = quint32;
+
+// Ausschnitt aus dem Textpuffer eines TokenStore
+struct TokenSpan {
+    quint32 offset = 0;
+    quint32 length = 0;
+};
+
+// ------------------------------------------------------------
+// Token-Struktur (POD)
+// ------------------------------------------------------------
+// Strings liegen nicht mehr im Token, sondern im TokenStore:
+//  - windowName / controlId → internierte Symbole
+//  - value / comment        → Spans in den gemeinsamen Textpuffer
 // ------------------------------------------------------------
 struct Token {
-    QString type;        // WindowHeader / ControlHeader / Text / Other
-    QString value;       // Originalzeile
-    QString windowName;  // Zugehöriges Fenster
-    QString controlId;   // Zugehöriges Control (falls vorhanden)
-    int orderIndex = -1; // Reihenfolge
-    QString comment;     // Letzter Kommentar
+    TokenKind   kind = TokenKind::Other;
+    int         orderIndex = -1; // Reihenfolge
+    TokenSymbol windowName = 0;  // Zugehöriges Fenster
+    TokenSymbol controlId = 0;   // Zugehöriges Control (falls vorhanden)
+    TokenSpan   value;           // Originalzeile
+    TokenSpan   comment;         // Letzter Kommentar
+};
+static_assert(std::is_trivially_copyable_v<Token>, "Token muss ein POD bleiben");
+
+// ------------------------------------------------------------
+// TokenStore
+// ------------------------------------------------------------
+// Hält die Tokens pro Fenster plus die Strings, auf die sie
+// verweisen. Symbole werden einmalig interniert, Zeileninhalte
+// landen in einem einzigen wachsenden Textpuffer.
+// ------------------------------------------------------------
+class TokenStore
+{
+public:
+    TokenStore() = default;
+
+    TokenStore(const TokenStore& other) { *this = other; }
+    TokenStore(TokenStore&&) = default;
+    TokenStore& operator=(TokenStore&&) = default;
+
+    // Symbol-Index zeigt auf die (implizit geteilten) Strings von m_symbols
+    // und muss daher bei Kopien neu aufgebaut werden.
+    TokenStore& operator=(const TokenStore& other)
+    {
+        if (this == &other)
+            return *this;
+        m_text    = other.m_text;
+        m_symbols = other.m_symbols;
+        m_windows = other.m_windows;
+        m_generation = other.m_generation;
+        m_symbolIds.clear();
+        for (qsizetype i = 0; i < m_symbols.size(); ++i)
+            m_symbolIds.emplace(QStringView(m_symbols[i]), TokenSymbol(i + 1));
+        return *this;
+    }
+
+    // --- Aufbau ---
+    TokenSymbol intern(QStringView s)
+    {
+        if (s.isEmpty())
+            return 0;
+
+        const auto it = m_symbolIds.find(s);
+        if (it != m_symbolIds.end())
+            return it->second;
+
+        m_symbols.append(s.toString());
+        const TokenSymbol id = TokenSymbol(m_symbols.size());
+        m_symbolIds.emplace(QStringView(m_symbols.constLast()), id);
+        return id;
+    }
+
+    TokenSpan store(QStringView s)
+    {
+        TokenSpan span;
+        span.offset = quint32(m_text.size());
+        span.length = quint32(s.size());
+        m_text.append(s);
+        return span;
+    }
+
+    void reserveText(qsizetype chars) { m_text.reserve(chars); }
+
+    QList<Token>& tokensFor(TokenSymbol window) { return m_windows[symbol(window)]; }
+
+    // --- Zugriff ---
+    const QString& symbol(TokenSymbol id) const
+    {
+        static const QString empty;
+        return (id > 0 && id <= TokenSymbol(m_symbols.size())) ? m_symbols[id - 1] : empty;
+    }
+
+    QStringView text(TokenSpan span) const
+    {
+        return QStringView(m_text).sliced(span.offset, span.length);
+    }
+
+    QStringView    value(const Token& t)      const { return text(t.value); }
+    QStringView    comment(const Token& t)    const { return text(t.comment); }
+    const QString& windowName(const Token& t) const { return symbol(t.windowName); }
+    const QString& controlId(const Token& t)  const { return symbol(t.controlId); }
+
+    const QMap<QString, QList<Token>>& windows() const { return m_windows; }
+    qsizetype windowCount() const { return m_windows.size(); }
+
+    // Generation, unter der TokenData diesen Stand veröffentlicht hat (0 = lokal)
+    quint64 generation() const { return m_generation; }
+
+private:
+    friend class TokenData;
+
+    struct ViewHash {
+        size_t operator()(QStringView v) const noexcept { return qHash(v); }
+    };
+
+    QString                      m_text;     // gemeinsamer Textpuffer
+    QList<QString>               m_symbols;  // Symbol n → m_symbols[n - 1]
+    std::unordered_map<QStringView, TokenSymbol, ViewHash> m_symbolIds;
+    QMap<QString, QList<Token>>  m_windows;  // Fenstername → Tokens
+    quint64                      m_generation = 0;
 };
 
+// Unveränderlicher, versionierter Stand des Tokenspeichers
+using TokenSnapshot = std::shared_ptr<const TokenStore>;
+
 // ------------------------------------------------------------
 // TokenData (Singleton)
 // ------------------------------------------------------------
 // Zentraler globaler Tokenspeicher, thread-sicher.
 // Alle Manager greifen hierauf zu.
+//  - Writer veröffentlichen einen kompletten TokenStore als neue
+//    Generation (atomarer shared_ptr-Tausch)
+//  - Reader holen sich einen Snapshot und halten ihn ohne Kopie
+//    und ohne Mutex; ältere Generationen leben, bis der letzte
+//    Snapshot freigegeben wird
 // ------------------------------------------------------------
 class TokenData
 {
@@ -31,27 +168,36 @@ public:
     }
 
     void clear() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_tokens.clear();
+        publish(TokenStore());
+    }
+
+    // Neue Generation veröffentlichen
+    void publish(TokenStore store) {
+        auto next = std::make_shared<TokenStore>(std::move(store));
+        next->m_generation = m_nextGeneration.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_store_explicit(&m_current,
+                                   TokenSnapshot(std::move(next)),
+                                   std::memory_order_release);
     }
 
-    void addTokens(const QString& windowName, const QList<Token>& tokens) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_tokens[windowName] = tokens;
+    // Aktuelle Generation (nie nullptr)
+    TokenSnapshot snapshot() const {
+        return std::atomic_load_explicit(&m_current, std::memory_order_acquire);
     }
 
+    quint64 generation() const { return snapshot()->generation(); }
+
     QList<Token> getTokens(const QString& windowName) const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_tokens.value(windowName);
+        return snapshot()->windows().value(windowName);
     }
 
-    QMap<QString, QList<Token>> all() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_tokens;
+    qsizetype windowCount() const {
+        return snapshot()->windowCount();
     }
 
 private:
     TokenData() = default;
-    mutable std::mutex m_mutex;
-    QMap<QString, QList<Token>> m_tokens;
+
+    TokenSnapshot m_current = std::make_shared<const TokenStore>();
+    std::atomic<quint64> m_nextGeneration { 1 };
 };
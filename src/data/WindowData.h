@@ -38,4 +38,8 @@ struct WindowData {
     QString rawHeader;            // Originaltextzeile des Fensters (z. B. "APP_CONFIRM_BUY ...")
     bool isCorrupted = false;
     BehaviorInfo behavior;
+
+    // Änderungszähler (LayoutManager::markWindowDirty); Render-Caches
+    // verwerfen ihr Bild, sobald er sich ändert
+    quint64 generation = 0;
 };
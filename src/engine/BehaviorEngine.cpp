@@ -16,7 +16,20 @@ BehaviorEngine::BehaviorEngine(BehaviorManager* behaviorMgr,
 
 void BehaviorEngine::setActiveWindow(const std::shared_ptr<WindowData>& wnd)
 {
+    if (m_activeWindow.lock() == wnd)
+        return;
+
+    // Zustände gehören zum alten Fenster
+    setHovered(nullptr);
+    setPressed(nullptr);
+
     m_activeWindow = wnd;
+    m_layoutValid  = false;
+}
+
+void BehaviorEngine::setCanvasSize(const QSize& size)
+{
+    m_canvasSize = size;
 }
 
 void BehaviorEngine::mousePress(const QPoint& pos,
@@ -26,8 +39,11 @@ void BehaviorEngine::mousePress(const QPoint& pos,
     Q_UNUSED(mods);
     m_lastPos = pos;
 
-    // später: HitTest, Auswahl, Drag-Start etc.
+    // später: Auswahl, Drag-Start etc.
     qDebug() << "[BehaviorEngine] mousePress@" << pos << "button" << button;
+
+    if (button == Qt::LeftButton)
+        setPressed(hitTest(pos));
 }
 
 void BehaviorEngine::mouseMove(const QPoint& pos,
@@ -39,6 +55,7 @@ void BehaviorEngine::mouseMove(const QPoint& pos,
         // später: Dragging etc.
     }
 
+    setHovered(hitTest(pos));
     m_lastPos = pos;
 }
 
@@ -49,16 +66,95 @@ void BehaviorEngine::mouseRelease(const QPoint& pos,
     Q_UNUSED(mods);
     qDebug() << "[BehaviorEngine] mouseRelease@" << pos << "button" << button;
     m_isDragging = false;
+
+    if (button == Qt::LeftButton)
+        setPressed(nullptr);
 }
 
 void BehaviorEngine::mouseLeave()
 {
-    // später: Hover-States zurücksetzen
     qDebug() << "[BehaviorEngine] mouseLeave";
+    setHovered(nullptr);
+    setPressed(nullptr);
+}
+
+// ------------------------------------------------------------
+// Oberstes Control unter pos (zuletzt gezeichnet = oben)
+// ------------------------------------------------------------
+std::shared_ptr<ControlData> BehaviorEngine::hitTest(const QPoint& pos)
+{
+    const auto wnd = m_activeWindow.lock();
+    if (!wnd || !m_layoutEngine || m_canvasSize.isEmpty())
+        return nullptr;
+
+    if (!m_layoutValid
+        || m_layoutGeneration != wnd->generation
+        || m_layoutSize != m_canvasSize)
+    {
+        m_layout           = m_layoutEngine->computeWindowLayout(wnd, m_canvasSize);
+        m_layoutGeneration = wnd->generation;
+        m_layoutSize       = m_canvasSize;
+        m_layoutValid      = true;
+    }
+
+    for (auto it = m_layout.controls.rbegin(); it != m_layout.controls.rend(); ++it)
+        if (it->data && it->renderRect.contains(pos))
+            return it->data;
+
+    return nullptr;
+}
+
+// Gleicher Rand wie RenderManager::refreshControls
+QRect BehaviorEngine::controlArea(const std::shared_ptr<ControlData>& ctrl) const
+{
+    if (!ctrl || !m_layoutValid)
+        return QRect();
+
+    for (const auto& info : m_layout.controls)
+        if (info.data == ctrl)
+            return info.renderRect.adjusted(-2, -2, 2, 2);
+
+    return QRect();
 }
 
-void BehaviorEngine::hitTest(const QPoint& pos)
+void BehaviorEngine::setHovered(const std::shared_ptr<ControlData>& ctrl)
 {
-    Q_UNUSED(pos);
-    // später: LayoutEngine → WindowRenderInfo cashen und dort Controls hit-testen
+    const auto previous = m_hovered.lock();
+    if (previous == ctrl)
+        return;
+
+    QRect area;
+    if (previous) {
+        previous->isHovered = false;
+        area |= controlArea(previous);
+    }
+    if (ctrl) {
+        ctrl->isHovered = true;
+        area |= controlArea(ctrl);
+    }
+
+    m_hovered = ctrl;
+    if (!area.isEmpty())
+        emit controlStateChanged(area);
+}
+
+void BehaviorEngine::setPressed(const std::shared_ptr<ControlData>& ctrl)
+{
+    const auto previous = m_pressed.lock();
+    if (previous == ctrl)
+        return;
+
+    QRect area;
+    if (previous) {
+        previous->isPressed = false;
+        area |= controlArea(previous);
+    }
+    if (ctrl) {
+        ctrl->isPressed = true;
+        area |= controlArea(ctrl);
+    }
+
+    m_pressed = ctrl;
+    if (!area.isEmpty())
+        emit controlStateChanged(area);
 }
@@ -2,12 +2,17 @@
 #pragma once
 #include <QObject>
 #include <QPoint>
+#include <QRect>
+#include <QSize>
 #include <QFlags>
 #include <memory>
 
+#include "layout/ControlLayout.h"
+
 class BehaviorManager;
 class LayoutEngine;
 struct WindowData;
+struct ControlData;
 
 class BehaviorEngine : public QObject {
     Q_OBJECT
@@ -17,6 +22,7 @@ public:
                             QObject* parent = nullptr);
 
     void setActiveWindow(const std::shared_ptr<WindowData>& wnd);
+    void setCanvasSize(const QSize& size);
 
     void mousePress(const QPoint& pos, Qt::MouseButton button, Qt::KeyboardModifiers mods);
     void mouseMove(const QPoint& pos, Qt::MouseButtons buttons, Qt::KeyboardModifiers mods);
@@ -26,14 +32,32 @@ public:
 signals:
     void selectionChanged();    // später für UI
 
+    // Hover-/Pressed-Zustand eines Controls geändert; area = betroffene
+    // Canvas-Fläche (Canvas::update(area), RenderManager zeichnet nur sie nach)
+    void controlStateChanged(const QRect& area);
+
 private:
     BehaviorManager* m_behaviorManager = nullptr;
     LayoutEngine*    m_layoutEngine    = nullptr;
 
     std::weak_ptr<WindowData> m_activeWindow;
+    QSize                     m_canvasSize;
+
+    // Layout des aktiven Fensters für Hit-Tests; neu bei anderer
+    // WindowData::generation oder Canvas-Größe
+    WindowRenderInfo m_layout;
+    quint64          m_layoutGeneration = 0;
+    QSize            m_layoutSize;
+    bool             m_layoutValid = false;
+
+    std::weak_ptr<ControlData> m_hovered;
+    std::weak_ptr<ControlData> m_pressed;
 
     QPoint m_lastPos;
     bool   m_isDragging = false;
 
-    void hitTest(const QPoint& pos);
+    std::shared_ptr<ControlData> hitTest(const QPoint& pos);
+    QRect controlArea(const std::shared_ptr<ControlData>& ctrl) const;
+    void setHovered(const std::shared_ptr<ControlData>& ctrl);
+    void setPressed(const std::shared_ptr<ControlData>& ctrl);
 };
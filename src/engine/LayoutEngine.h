@@ -36,6 +36,9 @@ private:
 
     QString m_currentWindow;
 
+    // Fenster-Tileset (wndtile00–11), Metriken kommen aus ThemeManager::windowSkin
+    const QString m_tileBase = QStringLiteral("wndtile");
+
     /// Zentriert das Fenster im Canvas.
     QRect computeWindowRectCentered(const WindowData& wnd,
                                     const QSize& canvasSize) const;
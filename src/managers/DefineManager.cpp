@@ -120,15 +120,18 @@ void DefineManager::generateDefines(const QMap<QString, std::shared_ptr<WindowDa
 // --------------------------------------------------
 // Rebuild aller Defines aus Tokens
 // --------------------------------------------------
-void DefineManager::rebuildFromTokens(const QList<Token>& tokens)
+void DefineManager::rebuildFromTokens(const TokenStore& store)
 {
     clear();
 
-    for (const Token& t : tokens)
+    for (const QList<Token>& tokens : store.windows())
     {
-        if (t.type == "Define")
+        for (const Token& t : tokens)
         {
-            QString line = t.value.trimmed();
+            if (t.kind != TokenKind::Define)
+                continue;
+
+            QString line = store.value(t).trimmed().toString();
             if (!line.startsWith("#define"))
                 continue;
 
@@ -154,30 +157,31 @@ void DefineManager::rebuildFromTokens(const QList<Token>& tokens)
 // --------------------------------------------------
 // Import (z. B. von externen Tokens)
 // --------------------------------------------------
-void DefineManager::importFromTokens(const QList<Token>& tokens)
+void DefineManager::importFromTokens(const TokenStore& store)
 {
-    rebuildFromTokens(tokens);
+    rebuildFromTokens(store);
     setDirty();
 }
 
 // --------------------------------------------------
 // Export zurück in Tokens
 // --------------------------------------------------
-QList<Token> DefineManager::exportToTokens() const
+TokenStore DefineManager::exportToTokens() const
 {
-    QList<Token> tokens;
+    TokenStore store;
+    QList<Token>& tokens = store.tokensFor(0);
 
     for (auto it = m_all.constBegin(); it != m_all.constEnd(); ++it)
     {
         Token t;
-        t.type = "Define";
-        t.value = QString("#define %1 0x%2")
-                      .arg(it.key())
-                      .arg(QString::number(it.value(), 16).toUpper());
+        t.kind = TokenKind::Define;
+        t.value = store.store(QString("#define %1 0x%2")
+                                  .arg(it.key())
+                                  .arg(QString::number(it.value(), 16).toUpper()));
         tokens.append(t);
     }
 
-    return tokens;
+    return store;
 }
 
 void DefineManager::applyDefinesToLayout(const std::vector<std::shared_ptr<WindowData>>& windows)
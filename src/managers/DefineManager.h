@@ -32,10 +32,10 @@ public:
     quint32 getValue(const QString& name) const;
 
     void generateDefines(const QMap<QString, std::shared_ptr<WindowData>>& windows);
-    void rebuildFromTokens(const QList<Token>& tokens);
+    void rebuildFromTokens(const TokenStore& store);
 
-    void importFromTokens(const QList<Token>& tokens);
-    QList<Token> exportToTokens() const;
+    void importFromTokens(const TokenStore& store);
+    TokenStore exportToTokens() const;
 
     const QMap<QString, quint32>& allDefines() const { return m_all; }
     const QMap<QString, quint32>& windowDefines() const { return m_windowDefines; }
@@ -5,19 +5,11 @@
 #include "model/TokenData.h"   // ggf. Pfad anpassen
 #include "model/WindowData.h"
 #include "model/ControlData.h"
+#include "LayoutHeaderParser.h"
+#include "utils/EncodingUtils.h"
 
 #include <QDebug>
-#include <QRegularExpression>
-
-// -------------------------------------------------------------
-// Hilfsfunktion
-// -------------------------------------------------------------
-QString LayoutManager::unquote(const QString& s) const
-{
-    if (s.size() >= 2 && s.front() == '"' && s.back() == '"')
-        return s.mid(1, s.size() - 2);
-    return s;
-}
+#include <QtConcurrent/QtConcurrentMap>
 
 // -------------------------------------------------------------
 // Konstruktor
@@ -35,225 +27,178 @@ LayoutManager::LayoutManager(LayoutParser& parser, LayoutBackend& backend)
 // -------------------------------------------------------------
 void LayoutManager::refreshFromParser()
 {
-    m_windows.clear();
+    const TokenSnapshot snapshot = TokenData::instance().snapshot();
+    adoptWindows(buildWindows(*snapshot));
+}
+
+// -------------------------------------------------------------
+// Fensterliste aus einem Token-Snapshot aufbauen (ohne Zustand)
+// -------------------------------------------------------------
+// Jedes Fenster hängt nur von seinen eigenen Tokens ab. Ab
+// kParallelRefreshThreshold Fenstern wird der Aufbau per QtConcurrent
+// auf den globalen Threadpool verteilt; blockingMapped liefert die
+// Ergebnisse in Eingabereihenfolge → Liste bleibt deterministisch.
+// Darf aus einem Worker-Thread aufgerufen werden.
+// -------------------------------------------------------------
+LayoutManager::WindowList LayoutManager::buildWindows(const TokenStore& store) const
+{
+    const auto& tokenMap = store.windows();
 
-    const auto tokenMap = TokenData::instance().all();
+    struct WindowJob {
+        const QString*      name;
+        const QList<Token>* tokens;
+    };
+
+    std::vector<WindowJob> jobs;
+    jobs.reserve(tokenMap.size());
 
     for (auto it = tokenMap.cbegin(); it != tokenMap.cend(); ++it)
     {
-        const QString       windowName = it.key();
-        const QList<Token>& tokens     = it.value();
-
-        if (tokens.isEmpty())
+        if (it.value().isEmpty())
             continue;
-        if (windowName.trimmed().isEmpty())
+        if (it.key().trimmed().isEmpty())
             continue;
 
-        auto win  = std::make_shared<WindowData>();
-        win->name = windowName;
+        jobs.push_back({ &it.key(), &it.value() });
+    }
 
-        int i = 0;
+    auto build = [this, &store](const WindowJob& job) {
+        return buildWindow(*job.name, *job.tokens, store);
+    };
 
-        // =========================================================
-        // Window-Header parsen
-        // =========================================================
-        while (i < tokens.size() && tokens[i].type != "WindowHeader")
-            ++i;
+    const bool parallel = m_parallelRefresh
+                          && jobs.size() >= kParallelRefreshThreshold;
 
-        if (i < tokens.size() && tokens[i].type == "WindowHeader")
-        {
-            const QStringList p = tokens[i].value.split(
-                QRegularExpression("\\s+"), Qt::SkipEmptyParts);
-            ++i;
+    WindowList windows;
 
-            // grob: 0: name/typ, 1: texture, 2: title, 3: modus,
-            //       4: width, 5: height, 6: flagsHex, 7: mod
-            if (p.size() >= 8)
-            {
-                win->texture   = unquote(p[1]);
-                win->titletext = p[2];
-                win->modus     = p[3].toInt();
-                win->x     = p[4].toInt();
-                win->y    = p[5].toInt();
-                win->flagsHex  = p[6];
-                win->mod       = p[7].toInt();
-
-                bool ok = false;
-                QString clean = win->flagsHex.trimmed().toUpper();
-                if (clean.startsWith("0X")) clean.remove(0, 2);
-                if (clean.endsWith("L"))   clean.chop(1);
-
-                win->flagsMask = clean.toUInt(&ok, 16);
-
-                if (!ok) {
-                    win->flagsMask = 0;
-                    qWarning().noquote()
-                        << "[LayoutManager] Ungültiger Window-Flagwert:"
-                        << win->flagsHex << "bei" << win->name;
-                }
-
-                // -------------------------------------------------
-                // 🛠 AUTO-FIX: kaputte Fensterflags hochschiften
-                // -------------------------------------------------
-                if (win->flagsMask > 0 && win->flagsMask < 0x10000)
-                {
-                    qWarning().noquote()
-                    << "[LayoutManager] Auto-Fix → Window" << win->name
-                    << "hat LOW-Flag 0x" + QString::number(win->flagsMask,16)
-                    << "→ shift nach HIGH.";
-
-                    win->flagsMask <<= 16;
-                }
-            }
-        }
+    if (parallel)
+    {
+        windows = QtConcurrent::blockingMapped<WindowList>(jobs, build);
+    }
+    else
+    {
+        windows.reserve(jobs.size());
+        for (const WindowJob& job : jobs)
+            windows.push_back(build(job));
+    }
 
-        // Window-Texte überspringen (werden beim Serialisieren direkt aus Tokens gelesen)
-        while (i < tokens.size() && tokens[i].type != "ControlHeader")
-            ++i;
+    qInfo().noquote()
+        << QString("[LayoutManager] Parserdaten übernommen → %1 Fenster (%2).")
+               .arg(windows.size())
+               .arg(parallel ? "parallel" : "seriell");
 
-        // =========================================================
-        // Controls einlesen
-        // =========================================================
-        while (i < tokens.size())
-        {
-            if (tokens[i].type != "ControlHeader")
-            {
-                ++i;
-                continue;
-            }
+    return windows;
+}
 
-            const Token& headerTok = tokens[i];
-            auto ctrl              = std::make_shared<ControlData>();
+// -------------------------------------------------------------
+// Fertige Fensterliste übernehmen (GUI-Thread)
+// -------------------------------------------------------------
+void LayoutManager::adoptWindows(WindowList windows)
+{
+    m_windows = std::move(windows);
 
-            ctrl->rawHeader = headerTok.value;
-            ctrl->tokens    = headerTok.value.split(
-                QRegularExpression("\\s+"), Qt::SkipEmptyParts);
+    rebuildIndex();
+    markAllDirty();
+}
 
-            const QStringList& p = ctrl->tokens;
+std::shared_ptr<WindowData> LayoutManager::buildWindow(const QString& windowName,
+                                                       const QList<Token>& tokens,
+                                                       const TokenStore& store) const
+{
+    auto win  = std::make_shared<WindowData>();
+    win->name = windowName;
 
-            // Struktur:
-            // 0: type
-            // 1: id
-            // 2: texture
-            // 3: mod0
-            // 4-7: x1 y1 x2 y2
-            // 8: flagsHex
-            // 9-12: mod1..mod4
-            // 13-15: ggf. Farbe (RGB oder packed)
+    int i = 0;
 
-            if (p.size() >= 1) ctrl->type    = p[0];
-            if (p.size() >= 2) ctrl->id      = p[1];
-            if (p.size() >= 3) ctrl->texture = unquote(p[2]);
-            if (p.size() >= 4) ctrl->mod0    = p[3].toInt();
+    // =========================================================
+    // Window-Header parsen
+    // =========================================================
+    while (i < tokens.size() && tokens[i].kind != TokenKind::WindowHeader)
+        ++i;
 
-            if (p.size() >= 8)
-            {
-                ctrl->x = p[4].toInt();
-                ctrl->y = p[5].toInt();
-                ctrl->x1 = p[6].toInt();
-                ctrl->y1 = p[7].toInt();
-            }
+    if (i < tokens.size() && tokens[i].kind == TokenKind::WindowHeader)
+    {
+        LayoutHeaderParser::Errors errors;
+        LayoutHeaderParser::parseWindowHeader(store.value(tokens[i]), *win, &errors);
+        ++i;
 
-            if (p.size() >= 9)
-            {
-                ctrl->flagsHex = p[8];
-
-                bool ok = false;
-                QString clean = ctrl->flagsHex.trimmed().toUpper();
-
-                // Präfixe entfernen
-                if (clean.startsWith("0X"))
-                    clean.remove(0, 2);
-                if (clean.endsWith("L"))
-                    clean.chop(1);
-
-                // In uint32 parsen
-                ctrl->flagsMask = clean.toUInt(&ok, 16);
-                if (!ok)
-                {
-                    ctrl->flagsMask = 0;
-                }
-
-                // --- Flags zerlegen ---
-                ctrl->lowFlags  =  ctrl->flagsMask        & 0x0000FFFF;
-                ctrl->midFlags  = (ctrl->flagsMask >> 16) & 0x000000FF;
-                ctrl->highFlags = (ctrl->flagsMask >> 24) & 0x000000FF;
-            }
+        for (const auto& e : errors)
+        {
+            qWarning().noquote()
+                << "[LayoutManager] Window-Header" << win->name << "→"
+                << LayoutHeaderParser::formatError(e);
+        }
 
-            if (p.size() >= 10) ctrl->mod1 = p[9].toInt();
-            if (p.size() >= 11) ctrl->mod2 = p[10].toInt();
-            if (p.size() >= 12) ctrl->mod3 = p[11].toInt();
-            if (p.size() >= 13) ctrl->mod4 = p[12].toInt();
+        // -------------------------------------------------
+        // 🛠 AUTO-FIX: kaputte Fensterflags hochschiften
+        // -------------------------------------------------
+        if (win->flagsMask > 0 && win->flagsMask < 0x10000)
+        {
+            qWarning().noquote()
+            << "[LayoutManager] Auto-Fix → Window" << win->name
+            << "hat LOW-Flag 0x" + QString::number(win->flagsMask,16)
+            << "→ shift nach HIGH.";
 
-            // --- Farbe ---
-            if (p.size() >= 16)
-            {
-                bool okR = false, okG = false, okB = false;
-                int v1   = p[13].toInt(&okR);
-                int v2   = p[14].toInt(&okG);
-                int v3   = p[15].toInt(&okB);
-
-                if (okR && okG && okB &&
-                    v1 >= 0 && v1 <= 255 &&
-                    v2 >= 0 && v2 <= 255 &&
-                    v3 >= 0 && v3 <= 255)
-                {
-                    ctrl->color = QColor(v1, v2, v3);
-                }
-                else
-                {
-                    bool okPacked = false;
-                    int packed    = p[13].toInt(&okPacked);
-                    if (okPacked)
-                    {
-                        quint32 u = static_cast<quint32>(packed);
-                        int r     = (u >> 16) & 0xFF;
-                        int g     = (u >> 8)  & 0xFF;
-                        int b     =  u        & 0xFF;
-                        ctrl->color = QColor(r, g, b);
-                    }
-                    else
-                    {
-                        ctrl->color = QColor(255, 255, 255);
-                    }
-                }
-            }
-            else
-            {
-                ctrl->color = QColor(255, 255, 255);
-            }
+            win->flagsMask <<= 16;
+        }
+    }
 
-            // nachfolgende Text-Tokens → Title / Tooltip
-            ++i; // hinter den Header
-            QString ctrlTitleId;
-            QString ctrlTooltipId;
-            int tcount = 0;
+    // Window-Texte überspringen (werden beim Serialisieren direkt aus Tokens gelesen)
+    while (i < tokens.size() && tokens[i].kind != TokenKind::ControlHeader)
+        ++i;
 
-            while (i < tokens.size() && tokens[i].type != "ControlHeader")
-            {
-                if (tokens[i].type == "Text")
-                {
-                    if (tcount == 0)
-                        ctrlTitleId = tokens[i].value.trimmed();
-                    else if (tcount == 1)
-                        ctrlTooltipId = tokens[i].value.trimmed();
-                    ++tcount;
-                }
-                ++i;
-            }
+    // =========================================================
+    // Controls einlesen
+    // =========================================================
+    while (i < tokens.size())
+    {
+        if (tokens[i].kind != TokenKind::ControlHeader)
+        {
+            ++i;
+            continue;
+        }
+
+        const Token& headerTok = tokens[i];
+        auto ctrl              = std::make_shared<ControlData>();
 
-            ctrl->titleId   = ctrlTitleId;
-            ctrl->tooltipId = ctrlTooltipId;
+        ctrl->rawHeader = store.value(headerTok).toString();
 
-            win->controls.push_back(ctrl);
+        LayoutHeaderParser::Errors errors;
+        LayoutHeaderParser::parseControlHeader(ctrl->rawHeader, *ctrl, &errors);
+
+        for (const auto& e : errors)
+        {
+            qWarning().noquote()
+                << "[LayoutManager] Control-Header" << windowName << ctrl->id << "→"
+                << LayoutHeaderParser::formatError(e);
         }
 
-        m_windows.push_back(win);
+        // nachfolgende Text-Tokens → Title / Tooltip
+        ++i; // hinter den Header
+        QString ctrlTitleId;
+        QString ctrlTooltipId;
+        int tcount = 0;
+
+        while (i < tokens.size() && tokens[i].kind != TokenKind::ControlHeader)
+        {
+            if (tokens[i].kind == TokenKind::Text)
+            {
+                if (tcount == 0)
+                    ctrlTitleId = store.value(tokens[i]).trimmed().toString();
+                else if (tcount == 1)
+                    ctrlTooltipId = store.value(tokens[i]).trimmed().toString();
+                ++tcount;
+            }
+            ++i;
+        }
+
+        ctrl->titleId   = ctrlTitleId;
+        ctrl->tooltipId = ctrlTooltipId;
+
+        win->controls.push_back(ctrl);
     }
 
-    qInfo().noquote()
-        << QString("[LayoutManager] Parserdaten übernommen → %1 Fenster.")
-               .arg(m_windows.size());
+    return win;
 }
 
 
@@ -261,6 +206,15 @@ void LayoutManager::refreshFromParser()
 // Layout verarbeiten (ruft BehaviorManager)
 // -------------------------------------------------------------
 void LayoutManager::processLayout()
+{
+    processWindows(m_windows);
+}
+
+// -------------------------------------------------------------
+// Validierung & Behavior-Zuordnung auf einer beliebigen Liste
+// (BehaviorManager wird nur lesend benutzt → Worker-tauglich)
+// -------------------------------------------------------------
+void LayoutManager::processWindows(const WindowList& windows) const
 {
     qInfo() << "[LayoutManager] Verarbeite Layouts...";
 
@@ -270,7 +224,7 @@ void LayoutManager::processLayout()
         return;
     }
 
-    for (auto& wndPtr : m_windows)
+    for (const auto& wndPtr : windows)
     {
         if (!wndPtr) continue;
 
@@ -291,8 +245,8 @@ void LayoutManager::processLayout()
     }
 
     // Nachgelagerte Analysen
-    m_behaviorManager->analyzeControlTypes(m_windows);
-    m_behaviorManager->generateUnknownControls(m_windows);
+    m_behaviorManager->analyzeControlTypes(windows);
+    m_behaviorManager->generateUnknownControls(windows);
 
     qInfo() << "[LayoutManager] Validierung & Behavior-Zuordnung abgeschlossen.";
 }
@@ -300,156 +254,200 @@ void LayoutManager::processLayout()
 // -------------------------------------------------------------
 // Layout serialisieren
 // -------------------------------------------------------------
-QString LayoutManager::serializeLayout() const
+// Jedes Fenster wird als eigener Textblock erzeugt und gecacht.
+// Ein Block hängt nur von den Tokens (Generation des Snapshots) und
+// dem zugehörigen WindowData ab; markWindowDirty() verwirft ihn
+// gezielt. Ein Speichern nach wenigen Änderungen erzeugt daher nur
+// die betroffenen Fenster neu, der Rest kommt unverändert aus dem
+// Cache und wird direkt auf das Gerät gestreamt.
+// -------------------------------------------------------------
+template <typename Sink>
+void LayoutManager::visitChunks(Sink&& sink) const
 {
-    QString out;
-    out.reserve(131072);
+    const TokenSnapshot snapshot = TokenData::instance().snapshot();
+    const TokenStore& store = *snapshot;
+    const auto& tokenMap = store.windows();
 
-    const auto& tokenMap = TokenData::instance().all();
+    // Neue Token-Generation → alle Blöcke ungültig
+    if (store.generation() != m_chunkGeneration)
+    {
+        m_chunkCache.clear();
+        m_chunkGeneration = store.generation();
+    }
+
+    int rebuilt = 0;
 
     for (auto it = tokenMap.cbegin(); it != tokenMap.cend(); ++it)
     {
-        const QString       windowName = it.key();
-        const QList<Token>& tokens     = it.value();
-
-        if (tokens.isEmpty())
+        if (it.value().isEmpty())
             continue;
 
-        // passendes WindowData suchen
-        std::shared_ptr<WindowData> winData;
-        for (const auto& w : m_windows)
+        auto cached = m_chunkCache.find(it.key());
+        if (cached == m_chunkCache.end())
         {
-            if (w && w->name.compare(windowName, Qt::CaseInsensitive) == 0)
-            {
-                winData = w;
-                break;
-            }
+            QString chunk;
+            serializeWindow(it.key(), it.value(), store, chunk);
+            cached = m_chunkCache.insert(it.key(), chunk);
+            ++rebuilt;
         }
 
-        int i = 0;
+        if (!cached->isEmpty())
+            sink(QStringView(*cached));
+    }
 
-        // WindowHeader schreiben
-        while (i < tokens.size() && tokens[i].type != "WindowHeader")
-            ++i;
-        if (i >= tokens.size())
-            continue;
+    qInfo().noquote()
+        << QString("[LayoutManager] Serialisiert → %1 Fenster, %2 neu erzeugt.")
+               .arg(m_chunkCache.size())
+               .arg(rebuilt);
+}
+
+QString LayoutManager::serializeLayout() const
+{
+    QString out;
+    out.reserve(131072);
 
-        const QString wndHeader = tokens[i++].value.trimmed();
-        out += wndHeader + "\r\n";
+    visitChunks([&out](QStringView chunk) { out += chunk; });
 
-        // Window-Texte (Title/Help)
-        QString titleId;
-        QString helpId;
-        int textCount = 0;
+    return out;
+}
+
+void LayoutManager::writeLayout(EncodingUtils::TextFileWriter& writer) const
+{
+    visitChunks([&writer](QStringView chunk) { writer.write(chunk); });
+}
+
+// -------------------------------------------------------------
+// Änderungsverfolgung
+// -------------------------------------------------------------
+void LayoutManager::markWindowDirty(const std::shared_ptr<WindowData>& wnd)
+{
+    if (!wnd)
+        return;
 
-        int j = i;
-        while (j < tokens.size() && tokens[j].type != "ControlHeader")
+    m_chunkCache.remove(wnd->name);
+    ++wnd->generation;
+}
+
+void LayoutManager::markAllDirty()
+{
+    m_chunkCache.clear();
+
+    for (const auto& wnd : m_windows)
+        if (wnd)
+            ++wnd->generation;
+}
+
+// -------------------------------------------------------------
+// Ein Fenster serialisieren
+// -------------------------------------------------------------
+void LayoutManager::serializeWindow(const QString& windowName,
+                                    const QList<Token>& tokens,
+                                    const TokenStore& store,
+                                    QString& out) const
+{
+    // passendes WindowData suchen
+    const std::shared_ptr<WindowData> winData = findWindow(windowName);
+
+    int i = 0;
+
+    // WindowHeader schreiben
+    while (i < tokens.size() && tokens[i].kind != TokenKind::WindowHeader)
+        ++i;
+    if (i >= tokens.size())
+        return;
+
+    const QString wndHeader = store.value(tokens[i++]).trimmed().toString();
+    out += wndHeader + "\r\n";
+
+    // Window-Texte (Title/Help)
+    QString titleId;
+    QString helpId;
+    int textCount = 0;
+
+    int j = i;
+    while (j < tokens.size() && tokens[j].kind != TokenKind::ControlHeader)
+    {
+        if (tokens[j].kind == TokenKind::Text)
         {
-            if (tokens[j].type == "Text")
-            {
-                if (textCount == 0)
-                    titleId = tokens[j].value.trimmed();
-                else if (textCount == 1)
-                    helpId = tokens[j].value.trimmed();
-                ++textCount;
-            }
-            ++j;
+            if (textCount == 0)
+                titleId = store.value(tokens[j]).trimmed().toString();
+            else if (textCount == 1)
+                helpId = store.value(tokens[j]).trimmed().toString();
+            ++textCount;
         }
-        i = j;
+        ++j;
+    }
+    i = j;
 
-        out += "{\r\n    // Title String\r\n";
-        if (!titleId.isEmpty())
-            out += "    " + titleId + "\r\n";
-        out += "}\r\n";
+    out += "{\r\n    // Title String\r\n";
+    if (!titleId.isEmpty())
+        out += "    " + titleId + "\r\n";
+    out += "}\r\n";
 
-        out += "{\r\n    // Help Key\r\n";
-        if (!helpId.isEmpty())
-            out += "    " + helpId + "\r\n";
-        out += "}\r\n";
+    out += "{\r\n    // Help Key\r\n";
+    if (!helpId.isEmpty())
+        out += "    " + helpId + "\r\n";
+    out += "}\r\n";
 
-        // Controls
-        out += "{\r\n";
+    // Controls
+    out += "{\r\n";
 
-        int controlIndex = 0;
+    int controlIndex = 0;
 
-        while (i < tokens.size())
+    while (i < tokens.size())
+    {
+        if (tokens[i].kind != TokenKind::ControlHeader)
         {
-            if (tokens[i].type != "ControlHeader")
-            {
-                ++i;
-                continue;
-            }
+            ++i;
+            continue;
+        }
 
-            const QString rawHeader = tokens[i++].value.trimmed();
-            QStringList parts = rawHeader.split(
-                QRegularExpression("\\s+"), Qt::SkipEmptyParts);
+        const QStringView rawHeader = store.value(tokens[i++]).trimmed();
 
-            std::shared_ptr<ControlData> ctrlData;
-            if (winData && controlIndex < winData->controls.size())
-            {
-                ctrlData = winData->controls[controlIndex];
-                ++controlIndex;
-            }
+        std::shared_ptr<ControlData> ctrlData;
+        if (winData && controlIndex < winData->controls.size())
+        {
+            ctrlData = winData->controls[controlIndex];
+            ++controlIndex;
+        }
 
-            // Falls wir eine dekodierte Farbe haben: RGB in Header schreiben
-            if (ctrlData && ctrlData->color.isValid())
-            {
-                const QColor& c = ctrlData->color;
-                QString r = QString::number(c.red());
-                QString g = QString::number(c.green());
-                QString b = QString::number(c.blue());
-
-                if (parts.size() >= 16)
-                {
-                    parts[13] = r;
-                    parts[14] = g;
-                    parts[15] = b;
-                }
-                else if (parts.size() >= 13)
-                {
-                    parts << r << g << b;
-                }
-                else
-                {
-                    parts << r << g << b;
-                }
-            }
+        // Falls wir eine dekodierte Farbe haben: RGB in Header schreiben
+        const QColor* color = (ctrlData && ctrlData->color.isValid()) ? &ctrlData->color : nullptr;
 
-            out += "    " + parts.join(" ") + "\r\n";
+        out += "    ";
+        LayoutHeaderParser::writeControlHeader(rawHeader, color, out);
+        out += "\r\n";
 
-            // nachfolgende Text-Tokens → Control-Title / Tooltip
-            QString ctrlTitleId;
-            QString ctrlTooltipId;
-            int tcount = 0;
+        // nachfolgende Text-Tokens → Control-Title / Tooltip
+        QString ctrlTitleId;
+        QString ctrlTooltipId;
+        int tcount = 0;
 
-            while (i < tokens.size() && tokens[i].type != "ControlHeader")
+        while (i < tokens.size() && tokens[i].kind != TokenKind::ControlHeader)
+        {
+            if (tokens[i].kind == TokenKind::Text)
             {
-                if (tokens[i].type == "Text")
-                {
-                    if (tcount == 0)
-                        ctrlTitleId = tokens[i].value.trimmed();
-                    else if (tcount == 1)
-                        ctrlTooltipId = tokens[i].value.trimmed();
-                    ++tcount;
-                }
-                ++i;
+                if (tcount == 0)
+                    ctrlTitleId = store.value(tokens[i]).trimmed().toString();
+                else if (tcount == 1)
+                    ctrlTooltipId = store.value(tokens[i]).trimmed().toString();
+                ++tcount;
             }
-
-            out += "    {\r\n        // Title String\r\n";
-            if (!ctrlTitleId.isEmpty())
-                out += "        " + ctrlTitleId + "\r\n";
-            out += "    }\r\n";
-
-            out += "    {\r\n        // ToolTip\r\n";
-            if (!ctrlTooltipId.isEmpty())
-                out += "        " + ctrlTooltipId + "\r\n";
-            out += "    }\r\n";
+            ++i;
         }
 
-        out += "}\r\n\r\n";
+        out += "    {\r\n        // Title String\r\n";
+        if (!ctrlTitleId.isEmpty())
+            out += "        " + ctrlTitleId + "\r\n";
+        out += "    }\r\n";
+
+        out += "    {\r\n        // ToolTip\r\n";
+        if (!ctrlTooltipId.isEmpty())
+            out += "        " + ctrlTooltipId + "\r\n";
+        out += "    }\r\n";
     }
 
-    return out;
+    out += "}\r\n\r\n";
 }
 
 // -------------------------------------------------------------
@@ -457,10 +455,54 @@ QString LayoutManager::serializeLayout() const
 // -------------------------------------------------------------
 std::shared_ptr<WindowData> LayoutManager::findWindow(const QString& name) const
 {
+    const auto it = m_windowIndex.constFind(indexKey(name));
+    return it != m_windowIndex.cend() ? it->window : nullptr;
+}
+
+// -------------------------------------------------------------
+// Control finden
+// -------------------------------------------------------------
+std::shared_ptr<ControlData> LayoutManager::findControl(const QString& windowName,
+                                                        const QString& controlId) const
+{
+    const auto it = m_windowIndex.constFind(indexKey(windowName));
+    if (it == m_windowIndex.cend())
+        return nullptr;
+
+    return it->controls.value(controlId);
+}
+
+// -------------------------------------------------------------
+// Suchindex
+// -------------------------------------------------------------
+void LayoutManager::rebuildIndex()
+{
+    m_windowIndex.clear();
+    m_windowIndex.reserve(qsizetype(m_windows.size()));
+
     for (const auto& wnd : m_windows)
     {
-        if (wnd && wnd->name.compare(name, Qt::CaseInsensitive) == 0)
-            return wnd;
+        if (!wnd)
+            continue;
+
+        const QString key = indexKey(wnd->name);
+        if (m_windowIndex.contains(key))
+            continue;
+
+        WindowIndexEntry& entry = m_windowIndex[key];
+        entry.window = wnd;
+        indexControls(entry);
+    }
+}
+
+void LayoutManager::indexControls(WindowIndexEntry& entry) const
+{
+    entry.controls.clear();
+    entry.controls.reserve(qsizetype(entry.window->controls.size()));
+
+    for (const auto& ctrl : entry.window->controls)
+    {
+        if (ctrl && !entry.controls.contains(ctrl->id))
+            entry.controls.insert(ctrl->id, ctrl);
     }
-    return nullptr;
 }
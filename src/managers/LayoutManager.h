@@ -2,6 +2,7 @@
 
 #include <QObject>
 #include <QString>
+#include <QHash>
 #include <memory>
 #include <vector>
 
@@ -12,6 +13,7 @@
 
 class LayoutBackend;
 class BehaviorManager;
+namespace EncodingUtils { class TextFileWriter; }
 
 // ================================================================
 // LayoutManager – kümmert sich um Layoutstruktur & Serialisierung
@@ -31,17 +33,43 @@ public:
     // ------------------------------
     void refreshFromParser();
 
+    // Paralleler Fensteraufbau (QtConcurrent) ab kParallelRefreshThreshold Fenstern
+    void setParallelRefresh(bool enabled) { m_parallelRefresh = enabled; }
+    bool parallelRefresh() const          { return m_parallelRefresh; }
+
     // ------------------------------
     // 🔹 Layout-Verarbeitung
     //    (ruft BehaviorManager für Validierung/Analyse auf)
     // ------------------------------
     void processLayout();
 
+    // ------------------------------
+    // 🔹 Zweiphasig (asynchrones Laden)
+    //    buildWindows/processWindows arbeiten ohne Manager-Zustand
+    //    (Worker-Thread), adoptWindows übernimmt im GUI-Thread
+    // ------------------------------
+    using WindowList = std::vector<std::shared_ptr<WindowData>>;
+
+    WindowList buildWindows(const TokenStore& store) const;
+    void processWindows(const WindowList& windows) const;
+    void adoptWindows(WindowList windows);
+
     // ------------------------------
     // 🔹 Serialisierung / Suche
     // ------------------------------
     QString serializeLayout() const;
+
+    // Streamt das Layout fensterweise in den Writer
+    void writeLayout(EncodingUtils::TextFileWriter& writer) const;
+
+    // Serialisierungs-Cache verwerfen + WindowData::generation erhöhen
+    // (Render-Cache)
+    void markWindowDirty(const std::shared_ptr<WindowData>& wnd);
+    void markAllDirty();
+
     std::shared_ptr<WindowData> findWindow(const QString& name) const;
+    std::shared_ptr<ControlData> findControl(const QString& windowName,
+                                             const QString& controlId) const;
 
     // ------------------------------
     // 🔹 Zugriff
@@ -65,5 +93,39 @@ private:
 
     std::vector<std::shared_ptr<WindowData>> m_windows;
 
-    QString unquote(const QString& s) const;
+    // ------------------------------
+    // 🔹 Suchindex
+    //    Fenstername (case-insensitiv) → Fenster + Control-ID → Control
+    //    Bei Duplikaten gewinnt der erste Eintrag (wie bei linearer Suche).
+    // ------------------------------
+    struct WindowIndexEntry {
+        std::shared_ptr<WindowData> window;
+        QHash<QString, std::shared_ptr<ControlData>> controls;
+    };
+    QHash<QString, WindowIndexEntry> m_windowIndex;
+
+    // ------------------------------
+    // 🔹 Serialisierungs-Cache
+    //    Token-Fenstername → fertiger Textblock (CRLF)
+    // ------------------------------
+    mutable QHash<QString, QString> m_chunkCache;
+    mutable quint64                 m_chunkGeneration = 0;
+
+    template <typename Sink>
+    void visitChunks(Sink&& sink) const;
+    void serializeWindow(const QString& windowName,
+                         const QList<Token>& tokens,
+                         const TokenStore& store,
+                         QString& out) const;
+
+    static QString indexKey(const QString& windowName) { return windowName.toCaseFolded(); }
+    void rebuildIndex();
+    void indexControls(WindowIndexEntry& entry) const;
+
+    static constexpr std::size_t kParallelRefreshThreshold = 64;
+    bool m_parallelRefresh = true;
+
+    std::shared_ptr<WindowData> buildWindow(const QString& windowName,
+                                            const QList<Token>& tokens,
+                                            const TokenStore& store) const;
 };
@@ -4,8 +4,10 @@
 #include "WindowData.h"
 #include "ControlData.h"
 #include "LayoutEngine.h"
+#include "ScaledPixmapCache.h"
 
 #include <QPainter>
+#include <QRegion>
 
 RenderManager::RenderManager(ThemeManager* theme,
                              BehaviorManager* behavior)
@@ -15,32 +17,156 @@ RenderManager::RenderManager(ThemeManager* theme,
     m_windowRender  = std::make_unique<RenderWindow>(theme, behavior);
     m_controlRender = std::make_unique<RenderControls>(theme, behavior);
     m_layoutEngine  = std::make_unique<LayoutEngine>(theme, behavior);
+
+    setCacheBudget(kDefaultCacheBudget);
+}
+
+void RenderManager::setCacheBudget(qint64 bytes)
+{
+    m_windowCache.setMaxCost(PixmapCost::budget(bytes));
+}
+
+// ------------------------------------------------------------
+// Interaktionszustand aus den Control-Daten
+// ------------------------------------------------------------
+ControlState RenderManager::stateFor(const ControlData& ctrl)
+{
+    if (ctrl.disabled)  return ControlState::Disabled;
+    if (ctrl.isPressed) return ControlState::Pressed;
+    if (ctrl.isHovered) return ControlState::Hover;
+    return ControlState::Normal;
+}
+
+bool RenderManager::isCurrent(const CachedWindow& entry,
+                              const std::shared_ptr<WindowData>& wnd,
+                              const QSize& canvasSize, qreal dpr) const
+{
+    const quint64 themeRevision = m_themeManager ? m_themeManager->revision() : 0;
+
+    return entry.window.lock() == wnd
+        && entry.generation == wnd->generation
+        && entry.themeRevision == themeRevision
+        && entry.canvasSize == canvasSize
+        && qFuzzyCompare(entry.dpr, dpr);
 }
 
 void RenderManager::render(QPainter* painter,
                            const std::shared_ptr<WindowData>& wnd,
                            const QSize& canvasSize)
 {
-    if (!painter || !wnd)
+    if (!painter || !wnd || canvasSize.isEmpty())
         return;
 
-    // Hintergrund
-    painter->save();
-    QRect canvasRect(0, 0, canvasSize.width(), canvasSize.height());
-    painter->fillRect(canvasRect, QColor(45, 45, 45));
-    painter->setPen(Qt::gray);
-    painter->drawRect(canvasRect.adjusted(0, 0, -1, -1));
-    painter->restore();
+    const qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+
+    QPixmap image;
+
+    if (CachedWindow* cached = m_windowCache.object(wnd.get());
+        cached && isCurrent(*cached, wnd, canvasSize, dpr))
+    {
+        // Nur geänderte Control-Zustände nachzeichnen
+        refreshControls(*cached);
+        image = cached->image;
+    }
+    else
+    {
+        auto entry = std::make_unique<CachedWindow>();
+        compose(*entry, wnd, canvasSize, dpr);
+        image = entry->image;
+
+        m_windowCache.insert(wnd.get(), entry.release(), PixmapCost::kib(image));
+    }
+
+    painter->drawPixmap(0, 0, image);
+}
+
+// ------------------------------------------------------------
+// Komplettes Bild aufbauen (Layout + Fenster + Controls)
+// ------------------------------------------------------------
+void RenderManager::compose(CachedWindow& entry,
+                            const std::shared_ptr<WindowData>& wnd,
+                            const QSize& canvasSize, qreal dpr)
+{
+    entry.window        = wnd;
+    entry.generation    = wnd->generation;
+    entry.themeRevision = m_themeManager ? m_themeManager->revision() : 0;
+    entry.canvasSize    = canvasSize;
+    entry.dpr           = dpr;
 
     // LayoutEngine berechnet: Position + Größe + Controls
-    WindowRenderInfo layoutInfo =
-        m_layoutEngine->computeWindowLayout(wnd, canvasSize);
+    entry.layout = m_layoutEngine->computeWindowLayout(wnd, canvasSize);
+
+    for (auto& info : entry.layout.controls)
+        if (info.data)
+            info.state = stateFor(*info.data);
+
+    entry.image = QPixmap(canvasSize * dpr);
+    entry.image.setDevicePixelRatio(dpr);
 
-    // Fenster rendern
+    QPainter p(&entry.image);
+    paintScene(p, entry, QRect());
+}
+
+// ------------------------------------------------------------
+// Hover/Pressed/Disabled: nur betroffene Rechtecke neu zeichnen
+// ------------------------------------------------------------
+void RenderManager::refreshControls(CachedWindow& entry)
+{
+    QRegion dirty;
+
+    for (auto& info : entry.layout.controls)
+    {
+        if (!info.data)
+            continue;
+
+        const ControlState state = stateFor(*info.data);
+        if (state == info.state)
+            continue;
+
+        info.state = state;
+
+        // Etwas Rand für Rahmen/Text, die über renderRect hinausragen
+        dirty += info.renderRect.adjusted(-2, -2, 2, 2);
+    }
+
+    if (dirty.isEmpty())
+        return;
+
+    QPainter p(&entry.image);
+    p.setClipRegion(dirty);
+    paintScene(p, entry, dirty.boundingRect());
+}
+
+// ------------------------------------------------------------
+// Hintergrund, Fenster, Controls (area leer = alles)
+// ------------------------------------------------------------
+void RenderManager::paintScene(QPainter& p, const CachedWindow& entry, const QRect& area)
+{
+    // Hintergrund
+    p.save();
+    QRect canvasRect(0, 0, entry.canvasSize.width(), entry.canvasSize.height());
+    p.fillRect(canvasRect, QColor(45, 45, 45));
+    p.setPen(Qt::gray);
+    p.drawRect(canvasRect.adjusted(0, 0, -1, -1));
+    p.restore();
+
+    // Fenster rendern (Skin kommt aus dem SliceRenderer-Cache)
     if (m_windowRender)
-        m_windowRender->render(*painter, layoutInfo);
+        m_windowRender->render(p, entry.layout);
+
+    if (!m_controlRender)
+        return;
+
+    // Controls rendern; beim Nachzeichnen nur die im Bereich
+    if (area.isNull()) {
+        m_controlRender->render(p, entry.layout.controls);
+        return;
+    }
+
+    std::vector<ControlRenderInfo> affected;
+    for (const auto& info : entry.layout.controls)
+        if (info.renderRect.intersects(area))
+            affected.push_back(info);
 
-    // Controls rendern
-    if (m_controlRender)
-        m_controlRender->render(*painter, layoutInfo.controls);
+    m_controlRender->render(p, affected);
 }
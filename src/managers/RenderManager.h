@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <QCache>
 #include <QPainter>
+#include <QPixmap>
 
 #include "RenderWindow.h"
 #include "RenderControls.h"
@@ -10,6 +12,7 @@
 class ThemeManager;
 class BehaviorManager;
 struct WindowData;
+struct ControlData;
 
 /**
  * RenderManager
@@ -18,6 +21,15 @@ struct WindowData;
  *  - LayoutEngine-Lauf
  *  - RenderWindow aufrufen
  *  - RenderControls aufrufen
+ *
+ * Retained Mode:
+ *  Das fertige Canvas-Bild wird pro Fenster gehalten und nur neu
+ *  aufgebaut, wenn sich Fensterdaten (WindowData::generation),
+ *  Theme (ThemeManager::revision), Canvas-Größe oder DPR ändern.
+ *  Ändert sich nur der Hover-/Pressed-/Disabled-Zustand eines
+ *  Controls, wird ausschließlich dessen Rechteck nachgezeichnet
+ *  (Hover/Pressed setzt BehaviorEngine, Canvas ruft update(rect)).
+ *  Ein Repaint ohne Änderung ist ein einzelner Blit.
  */
 class RenderManager
 {
@@ -28,6 +40,36 @@ public:
                 const std::shared_ptr<WindowData>& window,
                 const QSize& canvasSize);
 
+    // Budget für gecachte Fensterbilder (Bytes)
+    void setCacheBudget(qint64 bytes);
+    void clearCache() { m_windowCache.clear(); }
+
+private:
+    struct CachedWindow {
+        std::weak_ptr<WindowData> window;   // Identität (Adresse allein reicht nicht)
+        quint64          generation = 0;
+        quint64          themeRevision = 0;
+        QSize            canvasSize;
+        qreal            dpr = 1.0;
+        WindowRenderInfo layout;
+        QPixmap          image;
+    };
+
+    static ControlState stateFor(const ControlData& ctrl);
+
+    bool isCurrent(const CachedWindow& entry,
+                   const std::shared_ptr<WindowData>& wnd,
+                   const QSize& canvasSize, qreal dpr) const;
+    void compose(CachedWindow& entry, const std::shared_ptr<WindowData>& wnd,
+                 const QSize& canvasSize, qreal dpr);
+    void refreshControls(CachedWindow& entry);
+    void paintScene(QPainter& p, const CachedWindow& entry, const QRect& area);
+
+    static constexpr qint64 kDefaultCacheBudget = 64 * 1024 * 1024;
+
+    // Fenster → Bild; Kosten in KiB, LRU bei Überschreitung
+    QCache<const WindowData*, CachedWindow> m_windowCache;
+
 private:
     ThemeManager*      m_themeManager;
     BehaviorManager*   m_behaviorManager;
@@ -78,45 +78,56 @@ void TextManager::processIncLine(const QString& line)
 // ------------------------------------------------------------
 // Token-Rebuild (globaler Aufbau aus Tokens)
 // ------------------------------------------------------------
-void TextManager::rebuildFromTokens(const QList<Token>& tokens)
+void TextManager::rebuildFromTokens(const TokenStore& store)
 {
-    qInfo() << "[TextManager] Rebuild from Tokens gestartet (Tokens:" << tokens.size() << ")";
+    const auto& tokenMap = store.windows();
+
+    qsizetype tokenCount = 0;
+    for (const auto& list : tokenMap)
+        tokenCount += list.size();
+
+    qInfo() << "[TextManager] Rebuild from Tokens gestartet (Tokens:" << tokenCount << ")";
 
     m_groups.clear();
     m_idToGroup.clear();
 
-    QString currentTid;
     int countGroups = 0;
     int countIds = 0;
 
-    for (const Token& t : tokens) {
-        // Nur Tokens vom Typ "Text" oder "WindowHeader" berücksichtigen
-        if (t.type == "Text") {
-            // Fenstergruppe bestimmen
-            QString tid = t.windowName.isEmpty()
-                              ? QStringLiteral("TID_UNASSIGNED")
-                              : "TID_" + t.windowName.toUpper();
-
-            // Control-ID bestimmen
-            QString id = t.controlId.isEmpty()
-                             ? QStringLiteral("IDS_UNNAMED")
-                             : "IDS_" + t.controlId.toUpper();
-
-            addGroup(tid);
-            addIdToGroup(tid, id);
-
-            // Textwert übernehmen (falls vorhanden)
-            if (!t.value.isEmpty() && !m_texts.contains(id)) {
-                m_texts[id] = t.value;
-            }
+    for (const QList<Token>& tokens : tokenMap) {
+        for (const Token& t : tokens) {
+            // Nur Tokens vom Typ "Text" oder "WindowHeader" berücksichtigen
+            if (t.kind == TokenKind::Text) {
+                const QString& windowName = store.windowName(t);
+                const QString& controlId  = store.controlId(t);
+
+                // Fenstergruppe bestimmen
+                QString tid = windowName.isEmpty()
+                                  ? QStringLiteral("TID_UNASSIGNED")
+                                  : "TID_" + windowName.toUpper();
+
+                // Control-ID bestimmen
+                QString id = controlId.isEmpty()
+                                 ? QStringLiteral("IDS_UNNAMED")
+                                 : "IDS_" + controlId.toUpper();
+
+                addGroup(tid);
+                addIdToGroup(tid, id);
+
+                // Textwert übernehmen (falls vorhanden)
+                const QStringView value = store.value(t);
+                if (!value.isEmpty() && !m_texts.contains(id)) {
+                    m_texts[id] = value.toString();
+                }
 
-            ++countIds;
-        }
-        else if (t.type == "WindowHeader") {
-            // Fenster erzeugt eigene TID-Gruppe
-            QString tid = "TID_" + t.windowName.toUpper();
-            addGroup(tid);
-            ++countGroups;
+                ++countIds;
+            }
+            else if (t.kind == TokenKind::WindowHeader) {
+                // Fenster erzeugt eigene TID-Gruppe
+                QString tid = "TID_" + store.windowName(t).toUpper();
+                addGroup(tid);
+                ++countGroups;
+            }
         }
     }
 
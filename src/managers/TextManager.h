@@ -63,7 +63,7 @@ public:
     // ------------------------------------------------------------
     // Token-Integration
     // ------------------------------------------------------------
-    void rebuildFromTokens(const QList<Token>& tokens);
+    void rebuildFromTokens(const TokenStore& store);
 
     void applyTextsToLayout(const std::vector<std::shared_ptr<WindowData>>& windows);
 
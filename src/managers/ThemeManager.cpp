@@ -4,10 +4,22 @@
 #include <QDir>
 #include <QDebug>
 #include <QFileInfo>
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <algorithm>
+#include <iterator>
 
 ThemeManager::ThemeManager(FileManager* fileMgr, QObject* parent)
     : QObject(parent), m_fileMgr(fileMgr)
 {
+    // Gecachte WindowSkins/skalierte Texturen/Slices hängen am aktiven Theme
+    auto dropCaches = [this]() {
+        clearRenderCaches();
+        ++m_revision;
+    };
+    connect(this, &ThemeManager::texturesUpdated, this, dropCaches);
+    connect(this, &ThemeManager::themeChanged,    this, dropCaches);
 }
 
 void ThemeManager::refreshFromTokens(const QList<Token>& tokens)
@@ -20,12 +32,30 @@ void ThemeManager::clear()
 {
     m_themes.clear();
     m_currentTheme.clear();
+    clearRenderCaches();
+    ++m_revision;
+    rebuildResolved();
+}
+
+void ThemeManager::clearRenderCaches() const
+{
+    m_skinCache.clear();
+    m_scaledCache.clear();
+    m_sliceRenderer.clear();
 }
 
-QMap<QString, QPixmap> ThemeManager::loadPixmaps(const QString& dirPath,
-                                                 const QString& themeName)
+// ------------------------------------------------------------
+// Theme-Ordner einlesen (nur QImage, Threadpool)
+// ------------------------------------------------------------
+// Dekodieren und Clamp/Magenta laufen pro Datei parallel auf dem
+// globalen Threadpool; QPixmaps entstehen erst in adoptTheme().
+// Unveränderte Dateien kommen aus dem TextureCache des Ordners
+// (fertig nachbearbeitet und bereits in States zerlegt).
+// ------------------------------------------------------------
+QMap<QString, TextureCache::Texture> ThemeManager::loadImages(const QString& dirPath,
+                                                              const QString& themeName)
 {
-    QMap<QString, QPixmap> result;
+    QMap<QString, TextureCache::Texture> result;
 
     if (dirPath.isEmpty() || !QDir(dirPath).exists()) {
         qWarning() << "[ThemeManager] Ungültiger Theme-Pfad:" << dirPath;
@@ -43,50 +73,76 @@ QMap<QString, QPixmap> ThemeManager::loadPixmaps(const QString& dirPath,
     logFile.open(QIODevice::WriteOnly | QIODevice::Text);
     QTextStream log(&logFile);
 
-    int loaded = 0;
-    int failed = 0;
-
+    // 🔹 Dateiliste sammeln, dann parallel dekodieren + nachbearbeiten
+    QList<QFileInfo> files;
     while (it.hasNext()) {
-        QString filePath = it.next();
-        QFileInfo fi(filePath);
+        it.next();
+        files << it.fileInfo();
+    }
+
+    TextureCache cache(dirPath, "theme");
+
+    struct DecodedImage {
+        QFileInfo            info;
+        QString              key;
+        TextureCache::Texture texture;
+        bool                 cached = false;
+    };
+
+    auto decode = [&cache](const QFileInfo& fi) {
+        DecodedImage d;
+        d.info = fi;
 
         // 🔹 Der Key ist der Basisname in lowercase
-        QString key = fi.baseName().toLower();
+        d.key = fi.baseName().toLower();
 
-        QPixmap pix;
+        d.cached = cache.lookup(fi, d.texture);
+        if (d.cached)
+            return d;
 
-        // TGA mit Flyff-spezialbehandlung
-        if (fi.suffix().compare("tga", Qt::CaseInsensitive) == 0) {
-            QImage tga = ResourceUtils::loadFlyffTga(filePath);
-            if (!tga.isNull())
-                pix = QPixmap::fromImage(tga);
-        }
-        else {
-            QImageReader reader(filePath);
-            reader.setAutoTransform(true);
-            pix = QPixmap::fromImageReader(&reader);
-        }
+        // 🔹 Inkl. Flyff-typischer Korrekturen (Clamp + Magenta)
+        const QImage img = ResourceUtils::loadThemeImage(fi.filePath());
+        if (img.isNull())
+            return d;
+
+        d.texture.image  = img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        d.texture.slices = stateSlices(d.key, img.size());
+        return d;
+    };
 
-        if (pix.isNull()) {
-            log << "❌ Fehler: " << filePath << "\n";
+    // blockingMapped liefert in Eingabereihenfolge → gleiche Map wie seriell
+    const QList<DecodedImage> decoded =
+        QtConcurrent::blockingMapped<QList<DecodedImage>>(files, decode);
+
+    int loaded = 0;
+    int failed = 0;
+
+    for (const DecodedImage& d : decoded) {
+        if (d.texture.image.isNull()) {
+            log << "❌ Fehler: " << d.info.filePath() << "\n";
             failed++;
             continue;
         }
 
-        // 🔹 Flyff-typische Korrekturen
-        pix = ResourceUtils::clampTransparentEdges(pix);
-        pix = ResourceUtils::applyMagentaMask(pix);
+        if (d.cached)
+            cache.keep(d.info);
+        else
+            cache.insert(d.info, d.texture);
 
-        log << "✓ Geladen: " << key << " (" << pix.width() << "x" << pix.height() << ")\n";
-        result.insert(key, pix);
+        log << "✓ Geladen: " << d.key
+            << " (" << d.texture.image.width() << "x" << d.texture.image.height() << ")"
+            << (d.cached ? " (Cache)" : "") << "\n";
+        result.insert(d.key, d.texture);
         loaded++;
     }
 
     log << "\nGesamt geladen: " << loaded
         << " | Fehler: " << failed
-        << " | Dateien: " << (loaded + failed) << "\n";
+        << " | Dateien: " << (loaded + failed)
+        << " | Cache: " << cache.hits() << "\n";
 
     logFile.close();
+    cache.save();
 
     qInfo().noquote() << QString("[ThemeManager] Log-Datei: %1")
                              .arg(logFile.fileName());
@@ -96,9 +152,20 @@ QMap<QString, QPixmap> ThemeManager::loadPixmaps(const QString& dirPath,
 
 bool ThemeManager::loadTheme(const QString& themeName)
 {
+    return adoptTheme(decodeTheme(themeName));
+}
+
+// ------------------------------------------------------------
+// Dekodieren (nur QImage, kein Manager-Zustand → Worker-Thread)
+// ------------------------------------------------------------
+ThemeManager::ThemeImages ThemeManager::decodeTheme(const QString& themeName) const
+{
+    ThemeImages images;
+    images.name = themeName;
+
     if (!m_fileMgr) {
         qWarning() << "[ThemeManager] Kein FileManager gesetzt!";
-        return false;
+        return images;
     }
 
     QString defaultPath = m_fileMgr->defaultThemePath();
@@ -106,53 +173,103 @@ bool ThemeManager::loadTheme(const QString& themeName)
 
     if (defaultPath.isEmpty() || !QDir(defaultPath).exists()) {
         qWarning() << "[ThemeManager] Default-Theme nicht gefunden:" << defaultPath;
-        return false;
+        return images;
     }
 
     qInfo().noquote() << "[ThemeManager] Lade Theme:" << themeName;
 
+    // 2️⃣ Optionales Theme (z. B. English) parallel zum Default laden.
+    // Ist es der Default-Ordner selbst, nur einmal laden (sonst zwei
+    // Läufe auf demselben Debug-Log und TextureCache)
+    QFuture<QMap<QString, TextureCache::Texture>> custom;
+    const bool sameFolder = QDir::cleanPath(themePath) == QDir::cleanPath(defaultPath);
+    if (!themePath.isEmpty() && !sameFolder && QDir(themePath).exists())
+        custom = QtConcurrent::run(&ThemeManager::loadImages, themePath, themeName);
+
     // 1️⃣ Default-Theme laden
-    QMap<QString, QPixmap> defaultPixmaps =
-        loadPixmaps(defaultPath, "Default");
-
-    // 2️⃣ Optionales Theme (z. B. English) laden
-    QMap<QString, QPixmap> themePixmaps;
-    if (!themePath.isEmpty() && QDir(themePath).exists())
-        themePixmaps = loadPixmaps(themePath, themeName);
-
-    // 3️⃣ Theme-Mapping vorbereiten
-    QMap<QString, QMap<ControlState, QPixmap>> themeMap;
-
-    auto processPixmaps = [&](const QMap<QString, QPixmap>& pixmaps) {
-        for (auto it = pixmaps.begin(); it != pixmaps.end(); ++it) {
-            const QString key = it.key().toLower();
-            const QPixmap& pix = it.value();
-
-            if (pix.isNull())
-                continue;
-
-            QMap<ControlState, QPixmap> states;
-
-            // 🔹 1) Fenster-Tiles NIEMALS slicen
-            if (key.startsWith("wndtile")) {
-                states[ControlState::Normal] = pix;
-            }
-            // 🔹 2) Alle anderen "langen" Texturen wie gehabt in States zerlegen
-            else if (pix.width() >= pix.height() * 4) {
-                states = splitTextureByStates(pix);   // deine detectStateCount-Version
-            }
-            // 🔹 3) Normale, nicht-Strip Texturen
-            else {
-                states[ControlState::Normal] = pix;
-            }
-
-            themeMap[key] = states;
-        }
-    };
+    images.defaults = loadImages(defaultPath, "Default");
+
+    if (custom.isValid())
+        images.custom = custom.result();
+
+    // 3️⃣ Atlas packen (nur QImage → bleibt im Worker-Thread)
+    packAtlas(images);
+
+    images.valid = true;
+    return images;
+}
+
+// ------------------------------------------------------------
+// Atlas: alle State-Slices in wenige große Seiten packen
+// ------------------------------------------------------------
+void ThemeManager::packAtlas(ThemeImages& images)
+{
+    // Custom überschreibt Default (wie bisher beim Übernehmen)
+    QMap<QString, TextureCache::Texture> merged = images.defaults;
+    for (auto it = images.custom.cbegin(); it != images.custom.cend(); ++it)
+        merged.insert(it.key(), it.value());
+
+    // Jede Textur genau einmal; die States bleiben Teilrechtecke
+    TextureAtlas atlas;
+    QMap<QString, int> ids;
+
+    for (auto it = merged.cbegin(); it != merged.cend(); ++it) {
+        if (!it.value().image.isNull())
+            ids.insert(it.key(), atlas.add(it.value().image));
+    }
+
+    atlas.build();
+
+    images.atlasPages = atlas.pages();
+    images.packed.clear();
+
+    for (auto it = ids.cbegin(); it != ids.cend(); ++it) {
+        const TextureAtlas::Placement pl = atlas.placement(it.value());
+        if (pl.page < 0)
+            continue;
+
+        ThemeImages::PackedTexture& packed = images.packed[it.key()];
+        packed.page = pl.page;
+
+        for (const TextureCache::Slice& slice : merged[it.key()].slices)
+            packed.states[stateIndex(static_cast<ControlState>(slice.tag))] =
+                slice.rect.translated(pl.rect.topLeft());
+    }
+
+    qInfo().noquote() << QString("[ThemeManager] Atlas: %1 Texturen auf %2 Seiten")
+                             .arg(atlas.count())
+                             .arg(images.atlasPages.size());
+}
+
+// ------------------------------------------------------------
+// Übernehmen (QPixmap-Erzeugung → GUI-Thread)
+// ------------------------------------------------------------
+bool ThemeManager::adoptTheme(const ThemeImages& images)
+{
+    if (!images.valid)
+        return false;
+
+    const QString& themeName = images.name;
 
-    // 4️⃣ Default zuerst, dann Custom drüber
-    processPixmaps(defaultPixmaps);
-    processPixmaps(themePixmaps);
+    // 3️⃣ Atlas-Seiten hochladen (wenige große QPixmaps)
+    QList<QPixmap> pages;
+    pages.reserve(images.atlasPages.size());
+    for (const QImage& page : images.atlasPages)
+        pages.append(QPixmap::fromImage(page));
+
+    // 4️⃣ Theme-Mapping: Key → Record (Seite + State-Rechtecke)
+    QHash<QString, TextureRecord> themeMap;
+    themeMap.reserve(images.packed.size());
+
+    for (auto it = images.packed.cbegin(); it != images.packed.cend(); ++it) {
+        const ThemeImages::PackedTexture& packed = it.value();
+        if (packed.page < 0 || packed.page >= pages.size())
+            continue;
+
+        TextureRecord& rec = themeMap[it.key()];
+        rec.page = pages[packed.page];
+        std::copy(std::begin(packed.states), std::end(packed.states), std::begin(rec.states));
+    }
 
     // 5️⃣ In globale Map eintragen
     m_themes.insert(themeName.toLower(), themeMap);
@@ -165,6 +282,9 @@ bool ThemeManager::loadTheme(const QString& themeName)
     if (m_currentTheme.isEmpty())
         m_currentTheme = themeName.toLower();
 
+    // 7️⃣ Handles neu auflösen (alte Regions zeigen auf alte Seiten)
+    rebuildResolved();
+
     qInfo().noquote() << "[ThemeManager] Theme '" << themeName
                       << "' geladen (" << themeMap.size() << " Texturen)";
 
@@ -185,24 +305,22 @@ bool ThemeManager::setCurrentTheme(const QString& themeName)
         return true;
 
     m_currentTheme = lower;
+    rebuildResolved();
     qInfo().noquote() << "[ThemeManager] Aktives Theme geändert zu:" << m_currentTheme;
     emit themeChanged(m_currentTheme);
     emit texturesUpdated();
     return true;
 }
 
-int ThemeManager::detectStateCount(const QPixmap& src) const
+int ThemeManager::detectStateCount(int width)
 {
-    if (src.isNull())
-        return 1;
-
     static const QVector<int> candidates = {4, 6};
     int best = 4;
     int bestRest = INT_MAX;
 
     for (int c : candidates)
     {
-        int rest = src.width() % c;
+        int rest = width % c;
         if (rest < bestRest)
         {
             bestRest = rest;
@@ -216,109 +334,182 @@ int ThemeManager::detectStateCount(const QPixmap& src) const
     return best;
 }
 
-QMap<ControlState, QPixmap> ThemeManager::splitTextureByStates(const QPixmap& src) const
+// ------------------------------------------------------------
+// ControlState-Slices einer Textur
+// ------------------------------------------------------------
+//  - Fenster-Tiles und normale Texturen: ein Normal-Slice
+//  - "lange" Texturen (Breite >= 4 × Höhe): 4 oder 6 States,
+//    der Breitenrest geht an die ersten Slices
+// ------------------------------------------------------------
+QList<TextureCache::Slice> ThemeManager::stateSlices(const QString& key, const QSize& size)
 {
-    QMap<ControlState, QPixmap> map;
+    auto tag = [](ControlState s) { return static_cast<qint32>(s); };
+
+    // 🔹 Fenster-Tiles NIEMALS slicen
+    if (key.startsWith("wndtile") || size.width() < size.height() * 4)
+        return { { tag(ControlState::Normal), QRect(QPoint(0, 0), size) } };
 
-    if (src.isNull())
-        return map;
+    // 🔥 CLIENT-KORREKT: 4 States = Hover, Normal, Pressed, Disabled
+    //                    6 States = Radio / Check
+    static const ControlState order4[] = {
+        ControlState::Hover, ControlState::Normal,
+        ControlState::Pressed, ControlState::Disabled
+    };
+    static const ControlState order6[] = {
+        ControlState::Normal, ControlState::Hover, ControlState::Pressed,
+        ControlState::CheckedNormal, ControlState::CheckedHover, ControlState::CheckedPressed
+    };
 
-    int stateCount = detectStateCount(src);
-    const int W = src.width();
-    const int H = src.height();
+    const int stateCount = detectStateCount(size.width());
+    const ControlState* order = stateCount == 6 ? order6 : order4;
 
-    int base = W / stateCount;
-    int remainder = W % stateCount;
+    int base = size.width() / stateCount;
+    int remainder = size.width() % stateCount;
 
-    int x = 0;
-    QList<QPixmap> slices;
+    QList<TextureCache::Slice> slices;
+    slices.reserve(stateCount);
 
+    int x = 0;
     for (int i = 0; i < stateCount; ++i)
     {
         int w = base;
         if (remainder > 0) { w++; remainder--; }
 
-        QPixmap slice = src.copy(x, 0, w, H);
-        slices << slice;
-
+        slices.append({ tag(order[i]), QRect(x, 0, w, size.height()) });
         x += w;
     }
 
-    return mapStates(stateCount, slices, QString());
+    return slices;
 }
 
-QPixmap ThemeManager::texture(const QString& name, ControlState state) const
+// ------------------------------------------------------------
+// Textur-Handles
+// ------------------------------------------------------------
+int ThemeManager::stateIndex(ControlState state)
 {
-    if (m_currentTheme.isEmpty() || !m_themes.contains(m_currentTheme)) {
-        qWarning() << "[ThemeManager] Kein aktives Theme!";
-        return QPixmap();
+    switch (state)
+    {
+    case ControlState::Normal:         return 0;
+    case ControlState::Hover:          return 1;
+    case ControlState::Pressed:        return 2;
+    case ControlState::Disabled:       return 3;
+    case ControlState::CheckedNormal:  return 4;
+    case ControlState::CheckedHover:   return 5;
+    case ControlState::CheckedPressed: return 6;
+    default:                           break;
     }
+    return 0;
+}
 
-    QFileInfo fi(name);
-    QString key = fi.completeBaseName().toLower();
+ThemeManager::TextureId ThemeManager::textureId(const QString& name) const
+{
+    // Schneller Pfad: exakt dieser Name wurde schon aufgelöst
+    const auto known = m_idByName.constFind(name);
+    if (known != m_idByName.cend())
+        return known.value();
+
+    const QString key = QFileInfo(name.trimmed()).completeBaseName().toLower();
+    if (key.isEmpty())
+        return kNoTexture;
+
+    TextureId id = m_idByKey.value(key, kNoTexture);
+    if (id == kNoTexture) {
+        id = TextureId(m_textureKeys.size());
+        m_textureKeys.append(key);
+        m_idByKey.insert(key, id);
+        resolveTexture(id);
+
+        if (!m_currentTheme.isEmpty() && m_resolved[size_t(id) * kStateCount].isNull())
+            qWarning() << "[ThemeManager] Textur nicht gefunden:" << name;
+    }
 
-    const auto& themeMap = m_themes.value(m_currentTheme);
+    m_idByName.insert(name, id);
+    return id;
+}
 
-    auto fetchPixmap = [&](const QMap<QString, QMap<ControlState, QPixmap>>& map,
-                           const QString& debugName)
-    {
-        if (!map.contains(key))
-            return QPixmap();
+TextureRegion ThemeManager::texture(TextureId id, ControlState state) const
+{
+    if (id < 0)
+        return TextureRegion();
 
-        const auto& states = map.value(key);
+    const size_t slot = size_t(id) * kStateCount + size_t(stateIndex(state));
+    return slot < m_resolved.size() ? m_resolved[slot] : TextureRegion();
+}
 
-        if (states.contains(state))
-            return states.value(state);
+TextureRegion ThemeManager::texture(const QString& name, ControlState state) const
+{
+    return texture(textureId(name), state);
+}
 
-        if (states.contains(ControlState::Normal))
-            return states.value(ControlState::Normal);
+void ThemeManager::rebuildResolved()
+{
+    m_resolved.assign(size_t(m_textureKeys.size()) * kStateCount, TextureRegion());
 
-        return QPixmap();
-    };
+    for (TextureId id = 0; id < TextureId(m_textureKeys.size()); ++id)
+        resolveTexture(id);
+}
 
-    // 1) Aktives Theme
-    QPixmap pm = fetchPixmap(themeMap, "Active");
-    if (!pm.isNull())
-        return pm;
+// Fallback-Kette wie beim früheren Lookup:
+//   aktives Theme (State → Normal), dann Default-Theme (State → Normal)
+void ThemeManager::resolveTexture(TextureId id) const
+{
+    const size_t base = size_t(id) * kStateCount;
+    if (m_resolved.size() < base + kStateCount)
+        m_resolved.resize(base + kStateCount);
 
-    // 2) Fallback: Default Theme
-    if (m_themes.contains("default")) {
-        const auto& defMap = m_themes.value("default");
-        pm = fetchPixmap(defMap, "Default");
+    const QString& key = m_textureKeys[id];
 
-        if (!pm.isNull())
-            return pm;
-    }
+    auto lookup = [&](const QString& theme, int index) -> TextureRegion {
+        const auto t = m_themes.constFind(theme);
+        if (t == m_themes.cend())
+            return TextureRegion();
 
-    static QSet<QString> warned;
-    if (!warned.contains(key)) {
-        warned.insert(key);
-        qWarning() << "[ThemeManager] Textur nicht gefunden:" << name;
-    }
+        const auto k = t->constFind(key);
+        if (k == t->cend())
+            return TextureRegion();
+
+        return regionOf(k.value(), index);
+    };
+
+    for (int index = 0; index < kStateCount; ++index)
+    {
+        TextureRegion r;
+        if (!m_currentTheme.isEmpty())
+            r = lookup(m_currentTheme, index);
+        if (r.isNull())
+            r = lookup(QStringLiteral("default"), index);
 
-    return QPixmap();
+        m_resolved[base + size_t(index)] = r;
+    }
 }
 
-bool ThemeManager::matchesFullTexture(const QPixmap& pm, int wndW, int wndH) const
+// State → Normal (Index 0), sonst leer
+TextureRegion ThemeManager::regionOf(const TextureRecord& rec, int index)
 {
-    if (pm.isNull())
-        return false;
+    const QRect& r = rec.states[index];
+    if (!r.isEmpty())
+        return TextureRegion{ rec.page, r };
 
-    return pm.width() == wndW && pm.height() == wndH;
+    if (!rec.states[0].isEmpty())
+        return TextureRegion{ rec.page, rec.states[0] };
+
+    return TextureRegion();
 }
 
-bool ThemeManager::hasTileSet(const QString& baseName) const
+bool ThemeManager::matchesFullTexture(const TextureRegion& pm, int wndW, int wndH) const
 {
-    for (int i = 0; i < 12; i++)
-    {
-        QString key = QString("%1%2").arg(baseName).arg(i, 2, 10, QChar('0'));
+    if (pm.isNull())
+        return false;
 
-        if (textureFor(key).isNull())
-            return false;
-    }
-    return true;
+    return pm.width() == wndW && pm.height() == wndH;
 }
 
+// ------------------------------------------------------------
+// Tileset <baseName>00–11 inkl. Metriken aufbauen
+// ------------------------------------------------------------
+//  Fehlende Tiles bleiben leer (tileCount < 12); gültig als
+//  Tileset ist nur ein vollständiger Satz.
+// ------------------------------------------------------------
 ThemeManager::WindowSkin ThemeManager::buildTileSet(const QString& baseName) const
 {
     WindowSkin skin;
@@ -327,37 +518,52 @@ ThemeManager::WindowSkin ThemeManager::buildTileSet(const QString& baseName) con
     {
         QString key = QString("%1%2").arg(baseName).arg(i, 2, 10, QChar('0'));
 
-        skin.tiles[i] = textureFor(key);
+        skin.tiles[i] = texture(textureId(key), ControlState::Normal);
 
-        if (skin.tiles[i].isNull())
-            return skin;
+        if (!skin.tiles[i].isNull())
+            skin.tileCount++;
     }
 
-    skin.isTileset = true;
-    skin.valid = true;
+    const TextureRegion* t = skin.tiles;
+
+    skin.titleH  = t[1].height();
+    skin.topH    = t[1].height() + t[4].height();
+    skin.leftW   = t[6].width();
+    skin.rightW  = t[8].width();
+    skin.bottomH = t[10].height();
+
+    skin.isTileset = skin.tileCount == 12;
+    skin.valid     = skin.isTileset;
     return skin;
 }
 
-QPixmap ThemeManager::textureFor(const QString& name, ControlState state) const
+QPixmap ThemeManager::scaledTexture(TextureId id, ControlState state, const QSize& size) const
 {
-    if (!m_themes.contains(m_currentTheme))
-        return QPixmap();
+    const int index = stateIndex(state);
+    return m_scaledCache.scaled({ id, index, size }, texture(id, state));
+}
 
-    const auto& theme = m_themes[m_currentTheme];
+const ThemeManager::WindowSkin& ThemeManager::windowSkin(const QString& baseName) const
+{
+    auto it = m_skinCache.constFind(baseName);
+    if (it == m_skinCache.cend())
+        it = m_skinCache.insert(baseName, buildTileSet(baseName));
 
-    if (!theme.contains(name))
-        return QPixmap();
+    return it.value();
+}
 
-    const auto& states = theme[name];
+TextureRegion ThemeManager::textureFor(const QString& name, ControlState state) const
+{
+    const auto theme = m_themes.constFind(m_currentTheme);
+    if (theme == m_themes.cend())
+        return TextureRegion();
 
-    if (states.contains(state))
-        return states[state];
+    const auto rec = theme->constFind(name);
+    if (rec == theme->cend())
+        return TextureRegion();
 
     // Fallback auf Normal
-    if (states.contains(ControlState::Normal))
-        return states[ControlState::Normal];
-
-    return QPixmap();
+    return regionOf(rec.value(), stateIndex(state));
 }
 
 ThemeManager::WindowSkin ThemeManager::resolveWindowSkin(
@@ -368,16 +574,13 @@ ThemeManager::WindowSkin ThemeManager::resolveWindowSkin(
     if (texName.isEmpty())
         return ws;
 
-    // 1) Prüfe TileSet
-    if (hasTileSet(texName))
-    {
-        ws = buildTileSet(texName);
-        if (ws.valid)
-            return ws;
-    }
+    // 1) Prüfe TileSet (gecacht)
+    const WindowSkin& tiles = windowSkin(texName);
+    if (tiles.valid)
+        return tiles;
 
     // 2) Prüfe FullTexture
-    QPixmap pm = textureFor(texName);
+    TextureRegion pm = textureFor(texName);
     if (matchesFullTexture(pm, wndW, wndH))
     {
         ws.tiles[0] = pm;
@@ -392,21 +595,30 @@ ThemeManager::WindowSkin ThemeManager::resolveWindowSkin(
 
 bool ThemeManager::loadGameSourceColors(const QString& gameSourcePath)
 {
-    if (gameSourcePath.isEmpty())
-        return false;
+    return adoptGameSourceColors(extractGameSourceColors(gameSourcePath));
+}
 
-    delete m_colorExtractor;
+QMap<QString, QColor> ThemeManager::extractGameSourceColors(const QString& gameSourcePath)
+{
+    if (gameSourcePath.isEmpty())
+        return {};
 
     // FIX ✔️ Der Extractor benötigt den Source-Root, nicht den FileManager
-    m_colorExtractor = new ThemeColorExtractor(gameSourcePath);
+    ThemeColorExtractor extractor(gameSourcePath);
 
     // NEU ✔️ Wir extrahieren ALLE Farben, nicht nur UI-Farben
-    QMap<QString, QColor> extracted = m_colorExtractor->extractAllColors();
+    QMap<QString, QColor> extracted = extractor.extractAllColors();
 
-    if (extracted.isEmpty()) {
+    if (extracted.isEmpty())
         qWarning() << "[ThemeManager] WARNING: No colors extracted from source.";
+
+    return extracted;
+}
+
+bool ThemeManager::adoptGameSourceColors(const QMap<QString, QColor>& extracted)
+{
+    if (extracted.isEmpty())
         return false;
-    }
 
     // NEU ✔️ Vereinheitlichen & in m_processedColors speichern
     if (!processExtractedColors(extracted))
@@ -458,6 +670,8 @@ void ThemeManager::applyExtractedColors(const QMap<QString, QColor>& map)
 {
     for (auto it = map.begin(); it != map.end(); ++it)
         m_processedColors.colors[it.key()] = it.value();
+
+    ++m_revision;
 }
 
 QColor ThemeManager::color(const QString& key, const QColor& fallback) const
@@ -478,49 +692,3 @@ bool ThemeManager::saveUiColorsJson(const QMap<QString, QColor>& colors,
 
     return m_fileMgr->saveJsonObject(path, root);
 }
-
-QMap<ControlState, QPixmap> ThemeManager::mapStates(
-    int stateCount,
-    const QList<QPixmap>& slices,
-    const QString& texName) const
-{
-    QMap<ControlState, QPixmap> map;
-
-    if (stateCount == 1)
-    {
-        map[ControlState::Normal] = slices[0];
-        return map;
-    }
-
-    // 🔥 CLIENT-KORREKT für Buttons (4 States)
-    if (stateCount == 4)
-    {
-        // EXAKTE CLIENT-ANORDNUNG:
-        // 0 = HOVER
-        // 1 = NORMAL
-        // 2 = PRESSED
-        // 3 = DISABLED
-        map[ControlState::Hover]    = slices[0];
-        map[ControlState::Normal]   = slices[1];
-        map[ControlState::Pressed]  = slices[2];
-        map[ControlState::Disabled] = slices[3];
-
-        return map;
-    }
-
-    // 6-State (Radio / Check)
-    if (stateCount == 6)
-    {
-        map[ControlState::Normal]        = slices[0];
-        map[ControlState::Hover]         = slices[1];
-        map[ControlState::Pressed]       = slices[2];
-        map[ControlState::CheckedNormal] = slices[3];
-        map[ControlState::CheckedHover]  = slices[4];
-        map[ControlState::CheckedPressed]= slices[5];
-        return map;
-    }
-
-    // Fallback
-    map[ControlState::Normal] = slices[0];
-    return map;
-}
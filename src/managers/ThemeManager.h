@@ -2,8 +2,15 @@
 #include <QObject>
 #include <QMap>
 #include <QPixmap>
+#include <QImage>
+#include <QHash>
+#include <vector>
 #include "ControlState.h"
 #include "FileManager.h"
+#include "TextureAtlas.h"
+#include "TextureCache.h"
+#include "ScaledPixmapCache.h"
+#include "SliceRenderer.h"
 #include "ThemeColorExtractor.h"
 #include "TokenData.h"
 #include "ProcessedThemeColors.h"
@@ -17,22 +24,116 @@ class ThemeManager : public QObject
 public:
     explicit ThemeManager(FileManager* fileMgr, QObject* parent = nullptr);
 
+    // Anzahl ControlStates (Index siehe stateIndex)
+    static constexpr int kStateCount = 7;
+
+    // ------------------------------------------------------------
+    // TextureRecord – eine Textur mit allen States
+    // ------------------------------------------------------------
+    //  Die Textur liegt genau einmal im Atlas; States sind nur
+    //  Teilrechtecke darin (keine Kopien). Leeres Rechteck =
+    //  State nicht vorhanden.
+    // ------------------------------------------------------------
+    struct TextureRecord {
+        QPixmap page;
+        QRect   states[kStateCount];
+    };
+
     struct WindowSkin {
-        QPixmap tiles[12];
+        TextureRegion tiles[12];
         bool isTileset = false;
         bool valid = false;
+
+        // Vorberechnete Tile-Metriken (0 für fehlende Tiles)
+        int tileCount = 0;   // vorhandene Tiles (0–12)
+        int topH      = 0;   // 01 + 04 (Goldleiste + Header)
+        int titleH    = 0;   // 01
+        int leftW     = 0;   // 06
+        int rightW    = 0;   // 08
+        int bottomH   = 0;   // 10
+    };
+
+    // Dekodierte, noch nicht hochgeladene Theme-Bilder
+    // (inkl. vorberechneter ControlState-Slices, siehe stateSlices)
+    struct ThemeImages {
+        QString name;
+        QMap<QString, TextureCache::Texture> defaults;
+        QMap<QString, TextureCache::Texture> custom;
+
+        // Atlas aus Default + Custom (Custom überschreibt):
+        // je Textur ein Atlas-Rechteck, States als Teilrechtecke darin
+        struct PackedTexture {
+            int   page = -1;
+            QRect states[kStateCount];
+        };
+
+        QList<QImage> atlasPages;
+        QMap<QString, PackedTexture> packed;
+
+        bool valid = false;
     };
 
     void refreshFromTokens(const QList<Token>& tokens);
     bool loadTheme(const QString& themeName);
+
+    // Zweiphasig: decodeTheme ist thread-sicher (nur QImage),
+    // adoptTheme erzeugt die QPixmaps im GUI-Thread
+    ThemeImages decodeTheme(const QString& themeName) const;
+    bool adoptTheme(const ThemeImages& images);
     bool setCurrentTheme(const QString& themeName);
     QString currentTheme() const { return m_currentTheme; }
 
-    QPixmap texture(const QString& key, ControlState state) const;
+    // ------------------------------------------------------------
+    // Textur-Handles
+    // ------------------------------------------------------------
+    //  textureId() löst einen Namen einmalig auf (Groß-/Kleinschreibung,
+    //  Endung und Leerzeichen egal). Ids bleiben für die Lebensdauer
+    //  des ThemeManagers stabil, auch über Theme-Wechsel hinweg.
+    //  texture(id, state) ist danach ein reiner Array-Zugriff; der
+    //  Fallback (State → Normal → Default-Theme) ist vorberechnet.
+    //  Rückgabe als Wert (QPixmap implizit geteilt + QRect), da
+    //  textureId() mit neuem Namen die Tabelle vergrößern kann.
+    // ------------------------------------------------------------
+    using TextureId = int;
+    static constexpr TextureId kNoTexture = -1;
+
+    TextureId textureId(const QString& name) const;
+    TextureRegion texture(TextureId id, ControlState state) const;
+
+    // Komfort: textureId() + texture(id, state)
+    TextureRegion texture(const QString& key, ControlState state) const;
     WindowSkin resolveWindowSkin(const QString& texName, int wndW, int wndH) const;
 
+    // Auf Zielgröße skalierte Textur (Smooth), LRU-gecacht pro
+    // (Handle, State, Größe): einmal skaliert, danach ist jeder
+    // Repaint ein Blit. Ungültig ab texturesUpdated/themeChanged
+    QPixmap scaledTexture(TextureId id, ControlState state, const QSize& size) const;
+    void setScaledCacheBudget(qint64 bytes) { m_scaledCache.setBudget(bytes); }
+
+    // Nine-/Twelve-Slice-Renderer mit Geometrie-/Bild-Cache;
+    // wird mit den übrigen Theme-Caches geleert
+    RenderHelpers::SliceRenderer& sliceRenderer() const { return m_sliceRenderer; }
+
+    // WindowSkins, skalierte Texturen und Slice-Bilder verwerfen
+    // (bei texturesUpdated/themeChanged automatisch; Benchmark: kalt)
+    void clearRenderCaches() const;
+
+    // Gecachtes Tileset <baseName>00–11 inkl. Metriken (auch unvollständig).
+    // Referenz gültig bis texturesUpdated/themeChanged.
+    const WindowSkin& windowSkin(const QString& baseName) const;
+
+    // Zählt jede Änderung an Texturen, Theme oder Farben hoch
+    // (Render-Caches vergleichen nur diesen Wert)
+    quint64 revision() const { return m_revision; }
+
     bool loadGameSourceColors(const QString& gameSourcePath);
 
+    // Zweiphasig wie decodeTheme/adoptTheme: extractGameSourceColors ist
+    // thread-sicher (berührt keinen Manager-Zustand), adoptGameSourceColors
+    // übernimmt das Ergebnis im GUI-Thread
+    static QMap<QString, QColor> extractGameSourceColors(const QString& gameSourcePath);
+    bool adoptGameSourceColors(const QMap<QString, QColor>& extracted);
+
     QColor color(const QString& key,
                  const QColor& fallback = QColor(255,255,255)) const;
 
@@ -46,29 +147,49 @@ signals:
 
 private:
     void clear();
-    QMap<ControlState, QPixmap> mapStates(int stateCount,
-                                          const QList<QPixmap>& slices,
-                                          const QString& texName) const;
 
-    int detectStateCount(const QPixmap& src) const;
-    QMap<ControlState, QPixmap> splitTextureByStates(const QPixmap& src) const;
+    // Zerlegung einer Textur in ControlStates (Tag = ControlState)
+    static int detectStateCount(int width);
+    static QList<TextureCache::Slice> stateSlices(const QString& key, const QSize& size);
 
-    bool hasTileSet(const QString& baseName) const;
     WindowSkin buildTileSet(const QString& baseName) const;
-    bool matchesFullTexture(const QPixmap& pm, int wndW, int wndH) const;
-    QPixmap textureFor(const QString& name,
-                       ControlState state = ControlState::Normal) const;
+    bool matchesFullTexture(const TextureRegion& tex, int wndW, int wndH) const;
+    TextureRegion textureFor(const QString& name,
+                             ControlState state = ControlState::Normal) const;
+
+    static int stateIndex(ControlState state);
+    static TextureRegion regionOf(const TextureRecord& rec, int index);
+    void rebuildResolved();
+    void resolveTexture(TextureId id) const;
 
-    QMap<QString, QPixmap> loadPixmaps(const QString& path,
-                                       const QString& themeName);
+    static void packAtlas(ThemeImages& images);
+    static QMap<QString, TextureCache::Texture> loadImages(const QString& path,
+                                                           const QString& themeName);
 
     FileManager* m_fileMgr = nullptr;
     QString m_currentTheme;
 
     ProcessedThemeColors m_processedColors;
-    ThemeColorExtractor* m_colorExtractor = nullptr;
 
-    QMap<QString, QMap<QString, QMap<ControlState, QPixmap>>> m_themes;
+    // Theme → Key → Record
+    QMap<QString, QHash<QString, TextureRecord>> m_themes;
+
+    // Handle-Tabellen (nur GUI-Thread). m_resolved: kStateCount Einträge pro Id
+    mutable QList<QString>              m_textureKeys;
+    mutable QHash<QString, TextureId>   m_idByKey;
+    mutable QHash<QString, TextureId>   m_idByName;
+    mutable std::vector<TextureRegion>  m_resolved;
+
+    // WindowSkins pro Basisname (aktives Theme); QMap → stabile Referenzen
+    mutable QMap<QString, WindowSkin>   m_skinCache;
+
+    // Skalierte Control-Texturen (Button, GroupBox, ComboBox, …)
+    mutable ScaledPixmapCache           m_scaledCache;
+
+    // Fenster-/Edit-Skins (hält Atlas-Seiten → mit Theme leeren)
+    mutable RenderHelpers::SliceRenderer m_sliceRenderer;
+
+    quint64 m_revision = 0;
 
     void applyExtractedColors(const QMap<QString, QColor>& map);
     bool processExtractedColors(const QMap<QString, QColor>& extracted);
@@ -140,25 +140,15 @@ QRect LayoutEngine::computeWindowRectCentered(const WindowData& wnd,
 // -----------------------------------------------------------------------------
 QRect LayoutEngine::computeContentRectFromTiles(const QRect& wndRect) const
 {
-    auto tile = [&](int i) -> QPixmap {
-        QString key = QString("wndtile%1").arg(i, 2, 10, QChar('0'));
-        return m_themeMgr->texture(key, ControlState::Normal);
-    };
-
-    QPixmap t01 = tile(1);   // Top gold bar
-    QPixmap t04 = tile(4);   // Title/header
-    QPixmap t06 = tile(6);   // Left border
-    QPixmap t08 = tile(8);   // Right border
-    QPixmap t10 = tile(10);  // Bottom border
+    // 1) Basis-Padding aus den gecachten Tile-Metriken
+    //    (06 links, 08 rechts, 10 unten, 01 + 04 oben)
+    const ThemeManager::WindowSkin& skin = m_themeMgr->windowSkin(m_tileBase);
 
-    // 1) Basis-Padding aus Tiles
-    int tileLeft   = t06.isNull() ? 0 : t06.width();
-    int tileRight  = t08.isNull() ? 0 : t08.width();
-    int tileBottom = t10.isNull() ? 0 : t10.height();
+    int tileLeft   = skin.leftW;
+    int tileRight  = skin.rightW;
+    int tileBottom = skin.bottomH;
 
-    int tileTop = 0;
-    if (!t01.isNull()) tileTop += t01.height();
-    if (!t04.isNull()) tileTop += t04.height();
+    int tileTop = skin.topH;
     tileTop += 6; // FlyFF-typisches Abstand nach Header
 
     // 2) Fenstername ermitteln
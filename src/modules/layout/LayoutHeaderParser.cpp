@@ -0,0 +1,336 @@
+#include "LayoutHeaderParser.h"
+#include "WindowData.h"
+#include "ControlData.h"
+
+#include <QColor>
+#include <limits>
+
+namespace {
+
+void addError(LayoutHeaderParser::Errors* errors,
+              const LayoutHeaderParser::Field& field,
+              int index,
+              const char* what)
+{
+    if (!errors)
+        return;
+
+    LayoutHeaderParser::Error e;
+    e.field   = index;
+    e.column  = field.column;
+    e.message = QStringLiteral("%1: \"%2\"").arg(QLatin1StringView(what), field.text);
+    errors->append(e);
+}
+
+void addLineError(LayoutHeaderParser::Errors* errors, int found, int expected)
+{
+    if (!errors)
+        return;
+
+    LayoutHeaderParser::Error e;
+    e.field   = -1;
+    e.column  = 1;
+    e.message = QStringLiteral("zu wenige Felder (%1, mindestens %2)").arg(found).arg(expected);
+    errors->append(e);
+}
+
+void addLineWarning(LayoutHeaderParser::Errors* errors, int found, int expected)
+{
+    if (!errors)
+        return;
+
+    LayoutHeaderParser::Error e;
+    e.field   = -1;
+    e.column  = 1;
+    e.message = QStringLiteral("unvollständige Zeile (%1 von %2 Feldern), fehlende Felder bleiben unverändert")
+                    .arg(found).arg(expected);
+    e.warning = true;
+    errors->append(e);
+}
+
+inline int hexDigit(char16_t c)
+{
+    if (c >= u'0' && c <= u'9') return c - u'0';
+    if (c >= u'A' && c <= u'F') return c - u'A' + 10;
+    if (c >= u'a' && c <= u'f') return c - u'a' + 10;
+    return -1;
+}
+
+} // namespace
+
+// ------------------------------------------------------------
+// Zerlegen
+// ------------------------------------------------------------
+void LayoutHeaderParser::splitFields(QStringView line, Fields& out)
+{
+    out.clear();
+
+    const QChar* const data = line.data();
+    const qsizetype n = line.size();
+    qsizetype i = 0;
+
+    while (i < n)
+    {
+        while (i < n && data[i].isSpace())
+            ++i;
+        const qsizetype begin = i;
+        while (i < n && !data[i].isSpace())
+            ++i;
+        if (i > begin)
+            out.append({ QStringView(data + begin, i - begin), begin + 1 });
+    }
+}
+
+QStringView LayoutHeaderParser::unquote(QStringView s)
+{
+    if (s.size() >= 2 && s.front() == QLatin1Char('"') && s.back() == QLatin1Char('"'))
+        return s.sliced(1, s.size() - 2);
+    return s;
+}
+
+// ------------------------------------------------------------
+// Dezimalzahl mit optionalem Vorzeichen (wie QString::toInt)
+// ------------------------------------------------------------
+bool LayoutHeaderParser::parseInt(QStringView s, int& out)
+{
+    out = 0;
+
+    const qsizetype n = s.size();
+    qsizetype i = 0;
+    bool negative = false;
+
+    if (i < n && (s[i] == QLatin1Char('-') || s[i] == QLatin1Char('+'))) {
+        negative = s[i] == QLatin1Char('-');
+        ++i;
+    }
+    if (i == n)
+        return false;
+
+    qint64 value = 0;
+    const qint64 limit = negative ? qint64(std::numeric_limits<int>::max()) + 1
+                                  : qint64(std::numeric_limits<int>::max());
+
+    for (; i < n; ++i)
+    {
+        const char16_t c = s[i].unicode();
+        if (c < u'0' || c > u'9')
+            return false;
+        value = value * 10 + (c - u'0');
+        if (value > limit)
+            return false;
+    }
+
+    out = int(negative ? -value : value);
+    return true;
+}
+
+// ------------------------------------------------------------
+// Hex-Flags: [0x|0X]hex[L|l]
+// ------------------------------------------------------------
+bool LayoutHeaderParser::parseHexFlags(QStringView s, quint32& out)
+{
+    out = 0;
+
+    if (s.size() >= 2 && s[0] == QLatin1Char('0')
+        && (s[1] == QLatin1Char('x') || s[1] == QLatin1Char('X')))
+        s = s.sliced(2);
+    if (!s.isEmpty() && (s.back() == QLatin1Char('L') || s.back() == QLatin1Char('l')))
+        s.chop(1);
+    if (s.isEmpty())
+        return false;
+
+    quint64 value = 0;
+    for (const QChar ch : s)
+    {
+        const int d = hexDigit(ch.unicode());
+        if (d < 0)
+            return false;
+        value = (value << 4) | quint64(d);
+        if (value > 0xFFFFFFFFull)
+            return false;
+    }
+
+    out = quint32(value);
+    return true;
+}
+
+// ------------------------------------------------------------
+// Window-Header
+// ------------------------------------------------------------
+bool LayoutHeaderParser::parseWindowHeader(QStringView line, WindowData& wnd, Errors* errors)
+{
+    Fields f;
+    splitFields(line, f);
+
+    if (f.size() < kWindowFieldCount) {
+        addLineError(errors, int(f.size()), kWindowFieldCount);
+        return false;
+    }
+
+    bool ok = true;
+    auto intField = [&](int idx, int& target) {
+        if (!parseInt(f[idx].text, target)) {
+            addError(errors, f[idx], idx, "keine Ganzzahl");
+            ok = false;
+        }
+    };
+
+    wnd.texture   = unquote(f[1].text).toString();
+    wnd.titletext = f[2].text.toString();
+    intField(3, wnd.modus);
+    intField(4, wnd.x);
+    intField(5, wnd.y);
+    wnd.flagsHex  = f[6].text.toString();
+    intField(7, wnd.mod);
+
+    if (!parseHexFlags(f[6].text, wnd.flagsMask)) {
+        addError(errors, f[6], 6, "ungültiger Flagwert");
+        ok = false;
+    }
+
+    return ok;
+}
+
+// ------------------------------------------------------------
+// Control-Header
+// ------------------------------------------------------------
+bool LayoutHeaderParser::parseControlHeader(QStringView line, ControlData& ctrl, Errors* errors)
+{
+    Fields f;
+    splitFields(line, f);
+
+    const qsizetype n = f.size();
+    bool ok = true;
+
+    auto intField = [&](int idx, int& target) {
+        if (!parseInt(f[idx].text, target)) {
+            addError(errors, f[idx], idx, "keine Ganzzahl");
+            ok = false;
+        }
+    };
+
+    if (n >= 1) ctrl.type    = f[0].text.toString();
+    if (n >= 2) ctrl.id      = f[1].text.toString();
+    if (n >= 3) ctrl.texture = unquote(f[2].text).toString();
+    if (n >= 4) intField(3, ctrl.mod0);
+
+    if (n >= kControlMinFieldCount)
+    {
+        intField(4, ctrl.x);
+        intField(5, ctrl.y);
+        intField(6, ctrl.x1);
+        intField(7, ctrl.y1);
+
+        // 13 = ohne Farbe, 16 = mit Farbe; dazwischen fehlen Farbfelder
+        if (n < kControlNoColorFieldCount)
+            addLineWarning(errors, int(n), kControlNoColorFieldCount);
+        else if (n > kControlNoColorFieldCount && n < kControlFieldCount)
+            addLineWarning(errors, int(n), kControlFieldCount);
+    }
+    else
+    {
+        addLineError(errors, int(n), kControlMinFieldCount);
+        ok = false;
+    }
+
+    if (n >= 9)
+    {
+        ctrl.flagsHex = f[8].text.toString();
+
+        if (!parseHexFlags(f[8].text, ctrl.flagsMask)) {
+            addError(errors, f[8], 8, "ungültiger Flagwert");
+            ok = false;
+        }
+
+        // --- Flags zerlegen ---
+        ctrl.lowFlags  =  ctrl.flagsMask        & 0x0000FFFF;
+        ctrl.midFlags  = (ctrl.flagsMask >> 16) & 0x000000FF;
+        ctrl.highFlags = (ctrl.flagsMask >> 24) & 0x000000FF;
+    }
+
+    if (n >= 10) intField(9,  ctrl.mod1);
+    if (n >= 11) intField(10, ctrl.mod2);
+    if (n >= 12) intField(11, ctrl.mod3);
+    if (n >= 13) intField(12, ctrl.mod4);
+
+    // --- Farbe ---
+    ctrl.color = QColor(255, 255, 255);
+
+    if (n >= kControlFieldCount)
+    {
+        int v1 = 0, v2 = 0, v3 = 0;
+        const bool okR = parseInt(f[13].text, v1);
+        const bool okG = parseInt(f[14].text, v2);
+        const bool okB = parseInt(f[15].text, v3);
+
+        if (okR && okG && okB &&
+            v1 >= 0 && v1 <= 255 &&
+            v2 >= 0 && v2 <= 255 &&
+            v3 >= 0 && v3 <= 255)
+        {
+            ctrl.color = QColor(v1, v2, v3);
+        }
+        else if (okR)
+        {
+            // packed 0x00RRGGBB im ersten Farbfeld
+            const quint32 u = static_cast<quint32>(v1);
+            ctrl.color = QColor((u >> 16) & 0xFF, (u >> 8) & 0xFF, u & 0xFF);
+        }
+        else
+        {
+            addError(errors, f[13], 13, "ungültige Farbe");
+            ok = false;
+        }
+    }
+
+    return ok;
+}
+
+// ------------------------------------------------------------
+// Control-Header schreiben
+// ------------------------------------------------------------
+void LayoutHeaderParser::writeControlHeader(QStringView rawHeader, const QColor* color, QString& out)
+{
+    Fields f;
+    splitFields(rawHeader, f);
+
+    const qsizetype n = f.size();
+    const bool replaceColor = color && n >= kControlFieldCount;
+
+    for (qsizetype i = 0; i < n; ++i)
+    {
+        if (i > 0)
+            out += QLatin1Char(' ');
+
+        if (replaceColor && i == 13)      out += QString::number(color->red());
+        else if (replaceColor && i == 14) out += QString::number(color->green());
+        else if (replaceColor && i == 15) out += QString::number(color->blue());
+        else                              out += f[i].text;
+    }
+
+    // Weniger als 16 Felder → Farbe anhängen
+    if (color && !replaceColor)
+    {
+        if (n > 0)
+            out += QLatin1Char(' ');
+        out += QString::number(color->red());
+        out += QLatin1Char(' ');
+        out += QString::number(color->green());
+        out += QLatin1Char(' ');
+        out += QString::number(color->blue());
+    }
+}
+
+QString LayoutHeaderParser::formatError(const Error& e)
+{
+    const QString prefix = e.warning ? QStringLiteral("Warnung: ") : QString();
+
+    if (e.field < 0)
+        return QStringLiteral("%1Spalte %2: %3").arg(prefix).arg(e.column).arg(e.message);
+
+    return QStringLiteral("%1Feld %2, Spalte %3: %4")
+        .arg(prefix)
+        .arg(e.field)
+        .arg(e.column)
+        .arg(e.message);
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <QString>
+#include <QStringView>
+#include <QList>
+#include <QVarLengthArray>
+
+struct WindowData;
+struct ControlData;
+class QColor;
+
+// ------------------------------------------------------------
+// LayoutHeaderParser
+// ------------------------------------------------------------
+// Fest definiertes Schema der resdata.inc-Header:
+//
+//  Window (8 Felder):
+//   0: name  1: texture  2: title  3: modus
+//   4: width 5: height   6: flagsHex 7: mod
+//
+//  Control (16 Felder, mindestens 8):
+//   0: type  1: id  2: texture  3: mod0
+//   4-7: x y x1 y1  8: flagsHex  9-12: mod1..mod4
+//   13-15: Farbe (RGB oder packed)
+//
+// Control-Zeilen mit 13 (ohne Farbe) oder 16 Feldern sind normal.
+// 8–12 bzw. 14–15 Felder werden akzeptiert (fehlende Felder bleiben
+// unverändert), erzeugen aber eine Warnung.
+//
+// Zahlen, Hex-Flags (0x-Präfix, L-Suffix) und Farben werden direkt
+// aus dem Zeichenpuffer gelesen – kein Regex, keine QStringList.
+// Fehler werden pro Feld mit Spaltennummer gemeldet.
+// ------------------------------------------------------------
+class LayoutHeaderParser
+{
+public:
+    static constexpr int kWindowFieldCount  = 8;
+    static constexpr int kControlFieldCount = 16;
+    static constexpr int kControlMinFieldCount = 8;   // type … y1
+    static constexpr int kControlNoColorFieldCount = 13; // ohne Farbe (üblich)
+
+    struct Field {
+        QStringView text;
+        qsizetype   column = 0;   // 1-basiert, relativ zur Headerzeile
+    };
+    using Fields = QVarLengthArray<Field, kControlFieldCount>;
+
+    struct Error {
+        int       field = -1;     // Feldindex (-1 = ganze Zeile)
+        qsizetype column = 0;     // 1-basiert
+        QString   message;
+        bool      warning = false; // Zeile wurde trotzdem übernommen
+    };
+    using Errors = QList<Error>;
+
+    // Zerlegt eine Zeile an Whitespace
+    static void splitFields(QStringView line, Fields& out);
+
+    // Einzelwerte
+    static bool parseInt(QStringView s, int& out);
+    static bool parseHexFlags(QStringView s, quint32& out);
+
+    // Header → Daten (Felder, die fehlen, bleiben unverändert)
+    static bool parseWindowHeader(QStringView line, WindowData& wnd, Errors* errors = nullptr);
+    static bool parseControlHeader(QStringView line, ControlData& ctrl, Errors* errors = nullptr);
+
+    // Control-Header neu schreiben; Farbfelder 13–15 werden durch
+    // color ersetzt bzw. angehängt (color == nullptr → unverändert)
+    static void writeControlHeader(QStringView rawHeader, const QColor* color, QString& out);
+
+    static QString formatError(const Error& e);
+
+private:
+    static QStringView unquote(QStringView s);
+};
@@ -1,8 +1,8 @@
 #include "LayoutParser.h"
 #include "EncodingUtils.h"
+#include "LayoutTokenizer.h"
 #include "model/TokenData.h"
 #include <QDebug>
-#include <QRegularExpression>
 
 LayoutParser::LayoutParser(QObject* parent)
     : QObject(parent)
@@ -17,19 +17,100 @@ QString LayoutParser::unquote(const QString& s)
     return s;
 }
 
-// Liest Datei über EncodingUtils
+// ------------------------------------------------------------
+// TokenCollector – sammelt die Zeilen-Tokens pro Fenster
+// (gemeinsam für parse() und parseText())
+// ------------------------------------------------------------
+namespace {
+
+struct TokenCollector
+{
+    TokenStore store;
+    TokenSymbol currentWindow = 0;
+    QList<Token>* currentTokens = nullptr;
+
+    void operator()(const LayoutTokenizer::Line& line)
+    {
+        // „Other“-Tokens (Klammern) brauchen wir nicht persistent speichern
+        if (line.kind == LayoutTokenizer::Kind::Other)
+            return;
+
+        Token t;
+        t.value = store.store(line.value);
+        t.orderIndex = line.orderIndex;
+        t.windowName = currentWindow;
+
+        // --- Klassifizierung ---
+        switch (line.kind)
+        {
+        case LayoutTokenizer::Kind::Comment:
+            t.kind = TokenKind::Comment;
+            // Kommentartext liegt innerhalb der Zeile → kein zweiter Eintrag im Puffer
+            t.comment.offset = t.value.offset + quint32(line.comment.data() - line.value.data());
+            t.comment.length = quint32(line.comment.size());
+            break;
+
+        case LayoutTokenizer::Kind::WindowHeader:
+            t.kind = TokenKind::WindowHeader;
+            currentWindow = store.intern(line.name);
+            currentTokens = nullptr;
+            break;
+
+        case LayoutTokenizer::Kind::ControlHeader:
+            t.kind = TokenKind::ControlHeader;
+            t.controlId = store.intern(line.name);
+            break;
+
+        case LayoutTokenizer::Kind::Text:
+            t.kind = TokenKind::Text;
+            break;
+
+        default:
+            break;
+        }
+
+        // --- Speichern ---
+        if (!currentTokens)
+            currentTokens = &store.tokensFor(currentWindow);
+        currentTokens->append(t);
+    }
+
+    // Globale Speicherung (neue Generation in TokenData)
+    void publish()
+    {
+        TokenData::instance().publish(std::move(store));
+    }
+};
+
+} // namespace
+
+// Liest Datei über EncodingUtils: QFile::map + gestreamtes Dekodieren
+// in festen Chunks direkt in den Tokenizer (keine Volltext-Kopie)
 bool LayoutParser::parse(const QString& path)
 {
-    QFile file;
-    QTextStream in;
-    if (!EncodingUtils::openTextStream(file, in, path)) {
+    qInfo() << "[LayoutParser] Tokenisierung gestartet (gestreamt)...";
+
+    TokenCollector collector;
+    LayoutTokenizer::Stream stream;
+
+    const bool ok = EncodingUtils::decodeFileChunked(path, [&](QStringView chunk) {
+        stream.feed(chunk, collector);
+    });
+
+    if (!ok) {
         qWarning() << "[LayoutParser] Datei konnte nicht geöffnet werden:" << path;
         return false;
     }
 
-    QString text = in.readAll();
-    file.close();
-    return parseText(text);
+    stream.finish(collector);
+
+    collector.publish();
+
+    qInfo() << "[LayoutParser] Tokenisierung abgeschlossen. Tokens:"
+            << TokenData::instance().windowCount();
+
+    emit tokensReady();
+    return true;
 }
 
 // Tokenisierung aus Text
@@ -37,76 +118,22 @@ bool LayoutParser::parseText(const QString& text)
 {
     qInfo() << "[LayoutParser] Tokenisierung gestartet...";
 
-    TokenData::instance().clear();
     tokenize(text);
 
     qInfo() << "[LayoutParser] Tokenisierung abgeschlossen. Tokens:"
-            << TokenData::instance().all().size();
+            << TokenData::instance().windowCount();
 
     emit tokensReady();
     return true;
 }
 
 // Tokenisierung
+// Ein Durchlauf über den Puffer (LayoutTokenizer), Klassifizierung
+// per Zeichen-Dispatch. Nur gespeicherte Tokens werden materialisiert.
 void LayoutParser::tokenize(const QString& text)
 {
-    QStringList lines = text.split('\n');
-    QString currentWindow;
-    QString lastComment;
-    int order = 0;
-
-    QMap<QString, QList<Token>> tokenMap;
-    QList<Token> currentTokens;
-
-    for (QString rawLine : lines)
-    {
-        QString line = rawLine.trimmed();
-        if (line.isEmpty()) continue;
-
-        Token t;
-        t.value = line;
-        t.orderIndex = order++;
-        t.comment.clear();
-        t.windowName = currentWindow;
-
-        // --- Klassifizierung ---
-        if (line.startsWith("//")) {
-            // Kommentar → speichern, kann semantisch wichtig sein
-            t.type = "Comment";
-            lastComment = line.mid(2).trimmed();
-            t.comment = lastComment;
-        }
-        else if (line == "{" || line == "}") {
-            // Strukturklammer → Other
-            t.type = "Other";
-        }
-        else if (line.startsWith("APP_") || line.startsWith("WND_") ||
-                 line.startsWith("DPS_") || line.startsWith("CONFIRM_")) {
-            // Fensterheader
-            t.type = "WindowHeader";
-            currentWindow = line.section(' ', 0, 0);
-        }
-        else if (line.startsWith("WTYPE_")) {
-            // Controlheader
-            t.type = "ControlHeader";
-            t.controlId = line.section(' ', 1, 1);
-        }
-        else if (line.startsWith("IDS_RESDATA_INC_") || line.startsWith("IDS_")) {
-            // Textzeilen
-            t.type = "Text";
-        }
-        else {
-            // Alles andere
-            t.type = "Other";
-        }
-
-        // --- Speichern ---
-        // „Other“-Tokens (Klammern) brauchen wir nicht persistent speichern
-        if (t.type != "Other")
-            tokenMap[currentWindow].append(t);
-    }
-
-    // Globale Speicherung
-    for (auto it = tokenMap.cbegin(); it != tokenMap.cend(); ++it)
-        TokenData::instance().addTokens(it.key(), it.value());
+    TokenCollector collector;
+    collector.store.reserveText(text.size());
+    LayoutTokenizer::scan(text, collector);
+    collector.publish();
 }
@@ -0,0 +1,109 @@
+#include "LayoutTokenizer.h"
+
+// ------------------------------------------------------------
+// Klassifizierung über das erste Zeichen
+// ------------------------------------------------------------
+LayoutTokenizer::Kind LayoutTokenizer::classify(QStringView line)
+{
+    if (line.isEmpty())
+        return Kind::Other;
+
+    switch (line.front().unicode())
+    {
+    case u'/':
+        // Kommentar → kann semantisch wichtig sein
+        if (line.size() >= 2 && line[1] == QLatin1Char('/'))
+            return Kind::Comment;
+        break;
+
+    case u'A':
+        if (line.startsWith(QLatin1StringView("APP_")))
+            return Kind::WindowHeader;
+        break;
+
+    case u'W':
+        // WND_ → Fensterheader, WTYPE_ → Controlheader
+        if (line.startsWith(QLatin1StringView("WND_")))
+            return Kind::WindowHeader;
+        if (line.startsWith(QLatin1StringView("WTYPE_")))
+            return Kind::ControlHeader;
+        break;
+
+    case u'D':
+        if (line.startsWith(QLatin1StringView("DPS_")))
+            return Kind::WindowHeader;
+        break;
+
+    case u'C':
+        if (line.startsWith(QLatin1StringView("CONFIRM_")))
+            return Kind::WindowHeader;
+        break;
+
+    case u'I':
+        // IDS_RESDATA_INC_xxx und alle übrigen IDS_
+        if (line.startsWith(QLatin1StringView("IDS_")))
+            return Kind::Text;
+        break;
+
+    default:
+        // Strukturklammern und alles andere
+        break;
+    }
+
+    return Kind::Other;
+}
+
+// ------------------------------------------------------------
+// Feld n einer Zeile, getrennt durch genau ein Leerzeichen
+// (entspricht QString::section(' ', n, n))
+// ------------------------------------------------------------
+QStringView LayoutTokenizer::field(QStringView line, int index)
+{
+    qsizetype begin = 0;
+
+    for (int i = 0; i < index; ++i) {
+        const qsizetype sep = line.indexOf(QLatin1Char(' '), begin);
+        if (sep < 0)
+            return QStringView();
+        begin = sep + 1;
+    }
+
+    qsizetype end = line.indexOf(QLatin1Char(' '), begin);
+    if (end < 0)
+        end = line.size();
+
+    return line.sliced(begin, end - begin);
+}
+
+// ------------------------------------------------------------
+// Einzelne Zeile zerlegen
+// ------------------------------------------------------------
+bool LayoutTokenizer::tokenizeLine(QStringView rawLine, int orderIndex, Line& out)
+{
+    const QStringView line = rawLine.trimmed();
+    if (line.isEmpty())
+        return false;
+
+    out.kind       = classify(line);
+    out.value      = line;
+    out.name       = QStringView();
+    out.comment    = QStringView();
+    out.orderIndex = orderIndex;
+
+    switch (out.kind)
+    {
+    case Kind::Comment:
+        out.comment = line.sliced(2).trimmed();
+        break;
+    case Kind::WindowHeader:
+        out.name = field(line, 0);
+        break;
+    case Kind::ControlHeader:
+        out.name = field(line, 1);
+        break;
+    default:
+        break;
+    }
+
+    return true;
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <QString>
+#include <QStringView>
+
+// ------------------------------------------------------------
+// LayoutTokenizer
+// ------------------------------------------------------------
+// Zerlegt den dekodierten Inhalt von resdata.inc in einem
+// einzigen Durchlauf in Zeilen-Tokens.
+//  - Keine Kopien: alle Felder sind Views in den Quellpuffer
+//  - Keine Heap-Allokation pro Zeile
+//  - Klassifizierung über das erste Zeichen (switch) statt
+//    über mehrere startsWith()-Aufrufe
+// Die Semantik entspricht exakt der bisherigen Zerlegung
+// (split('\n') + trimmed() + Präfixtests).
+// ------------------------------------------------------------
+class LayoutTokenizer
+{
+public:
+    enum class Kind : quint8 {
+        Comment,
+        WindowHeader,
+        ControlHeader,
+        Text,
+        Other
+    };
+
+    struct Line {
+        Kind        kind = Kind::Other;
+        QStringView value;       // getrimmte Zeile
+        QStringView name;        // WindowHeader: Fenstername / ControlHeader: Control-ID
+        QStringView comment;     // Comment: Text hinter "//" (getrimmt)
+        int         orderIndex = -1;
+    };
+
+    // Klassifiziert eine bereits getrimmte, nicht-leere Zeile
+    static Kind classify(QStringView line);
+
+    // Zerlegt eine einzelne Rohzeile (ohne '\n').
+    // Gibt false zurück, wenn die Zeile leer ist.
+    static bool tokenizeLine(QStringView rawLine, int orderIndex, Line& out);
+
+    // Läuft einmal über den Puffer und ruft sink(const Line&) für jede
+    // nicht-leere Zeile auf. Gibt den nächsten freien orderIndex zurück.
+    template <typename Sink>
+    static int scan(QStringView text, Sink&& sink, int order = 0)
+    {
+        const QChar* const data = text.data();
+        const qsizetype size = text.size();
+
+        Line line;
+        qsizetype begin = 0;
+
+        while (begin <= size)
+        {
+            qsizetype end = begin;
+            while (end < size && data[end] != QLatin1Char('\n'))
+                ++end;
+
+            if (tokenizeLine(QStringView(data + begin, end - begin), order, line)) {
+                ++order;
+                sink(static_cast<const Line&>(line));
+            }
+
+            begin = end + 1;
+        }
+
+        return order;
+    }
+
+    // --------------------------------------------------------
+    // Stream – nimmt dekodierte Chunks entgegen (z. B. aus
+    // EncodingUtils::decodeFileChunked). Vollständige Zeilen werden
+    // direkt im Chunk zerlegt; nur ein angebrochener Zeilenrest wird
+    // bis zum nächsten Chunk zwischengespeichert.
+    // Die Views in Line sind nur während des sink-Aufrufs gültig.
+    // --------------------------------------------------------
+    class Stream
+    {
+    public:
+        template <typename Sink>
+        void feed(QStringView chunk, Sink&& sink)
+        {
+            const QChar* const data = chunk.data();
+            const qsizetype size = chunk.size();
+            qsizetype begin = 0;
+
+            // Angebrochene Zeile aus dem vorherigen Chunk vervollständigen
+            if (!m_carry.isEmpty()) {
+                const qsizetype nl = chunk.indexOf(QLatin1Char('\n'));
+                if (nl < 0) {
+                    m_carry.append(chunk);
+                    return;
+                }
+                m_carry.append(chunk.first(nl));
+                emitLine(m_carry, sink);
+                m_carry.resize(0); // Kapazität bleibt erhalten
+                begin = nl + 1;
+            }
+
+            for (;;) {
+                qsizetype end = begin;
+                while (end < size && data[end] != QLatin1Char('\n'))
+                    ++end;
+
+                if (end == size) {
+                    m_carry.append(QStringView(data + begin, size - begin));
+                    return;
+                }
+
+                emitLine(QStringView(data + begin, end - begin), sink);
+                begin = end + 1;
+            }
+        }
+
+        template <typename Sink>
+        void finish(Sink&& sink)
+        {
+            emitLine(m_carry, sink);
+            m_carry.resize(0);
+        }
+
+        int nextOrderIndex() const { return m_order; }
+
+    private:
+        template <typename Sink>
+        void emitLine(QStringView rawLine, Sink& sink)
+        {
+            if (tokenizeLine(rawLine, m_order, m_line)) {
+                ++m_order;
+                sink(static_cast<const Line&>(m_line));
+            }
+        }
+
+        QString m_carry;
+        Line    m_line;
+        int     m_order = 0;
+    };
+
+private:
+    static QStringView field(QStringView line, int index);
+};
@@ -43,4 +43,9 @@ private:
 private:
     ThemeManager*    m_themeManager   = nullptr;
     BehaviorManager* m_behaviorManager = nullptr;
+
+    // Fenster-Tileset (wndtile00–11) und einmalig aufgelöste Titelbuttons
+    const QString           m_tileBase = QStringLiteral("wndtile");
+    ThemeManager::TextureId m_exitId = ThemeManager::kNoTexture;
+    ThemeManager::TextureId m_helpId = ThemeManager::kNoTexture;
 };
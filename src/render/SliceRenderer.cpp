@@ -0,0 +1,242 @@
+#include "render/SliceRenderer.h"
+#include "utils/ScaledPixmapCache.h"
+
+namespace RenderHelpers
+{
+
+namespace
+{
+// Geometrie ist winzig; Anzahl Einträge statt Bytes
+constexpr int kGeometryEntries = 256;
+
+// ------------------------------------------------------------
+// Sammelt Fragmente; ein Seitenwechsel eröffnet einen neuen
+// Batch, damit die Zeichenreihenfolge erhalten bleibt
+// ------------------------------------------------------------
+class FragmentSink
+{
+public:
+    FragmentSink(QList<SliceRenderer::Batch>* batches, qreal opacity)
+        : m_batches(batches), m_opacity(opacity) {}
+
+    // 1:1 an Position
+    void place(const TextureRegion& tex, int x, int y)
+    {
+        if (tex.isNull())
+            return;
+
+        append(tex, QPointF(x + tex.width() / 2.0, y + tex.height() / 2.0),
+               QRectF(tex.rect));
+    }
+
+    // Fläche kacheln, Randkacheln beschneiden
+    void tile(const TextureRegion& tex, const QRect& target)
+    {
+        if (tex.isNull() || target.isEmpty())
+            return;
+
+        const int tw = tex.width();
+        const int th = tex.height();
+
+        for (int y = target.top(); y <= target.bottom(); y += th)
+        {
+            const int h = qMin(th, target.bottom() - y + 1);
+
+            for (int x = target.left(); x <= target.right(); x += tw)
+            {
+                const int w = qMin(tw, target.right() - x + 1);
+                append(tex, QPointF(x + w / 2.0, y + h / 2.0),
+                       QRectF(tex.rect.x(), tex.rect.y(), w, h));
+            }
+        }
+    }
+
+private:
+    void append(const TextureRegion& tex, const QPointF& center, const QRectF& source)
+    {
+        if (m_batches->isEmpty() || m_batches->last().page.cacheKey() != tex.page.cacheKey())
+            m_batches->append({ tex.page, {} });
+
+        m_batches->last().fragments.append(
+            QPainter::PixmapFragment::create(center, source, 1, 1, 0, m_opacity));
+    }
+
+    QList<SliceRenderer::Batch>* m_batches;
+    qreal m_opacity = 1.0;
+};
+} // namespace
+
+SliceRenderer::SliceRenderer()
+{
+    m_geometry.setMaxCost(kGeometryEntries);
+    setBudget(kDefaultBudget);
+}
+
+void SliceRenderer::setBudget(qint64 bytes)
+{
+    m_composed.setMaxCost(PixmapCost::budget(bytes));
+}
+
+void SliceRenderer::clear()
+{
+    m_geometry.clear();
+    m_composed.clear();
+}
+
+// ------------------------------------------------------------
+// Skin-Identität: Layout + Seite/Rechteck jedes Tiles
+// ------------------------------------------------------------
+void SliceRenderer::fillSkin(Key& key, Layout layout, const TextureRegion* tiles)
+{
+    key.layout = layout;
+
+    const int count = tileCount(layout);
+    for (int i = 0; i < count; ++i)
+    {
+        const TextureRegion& t = tiles[i];
+        if (!t.isNull())
+            key.tiles[size_t(i)] = { t.page.cacheKey(), t.rect };
+    }
+}
+
+// ------------------------------------------------------------
+// Patch-Geometrie relativ zu (0,0)
+// ------------------------------------------------------------
+SliceRenderer::Geometry SliceRenderer::build(Layout layout,
+                                             const TextureRegion* t,
+                                             const QSize& size,
+                                             qreal opacity)
+{
+    Geometry geo;
+    FragmentSink sink(&geo.batches, opacity);
+
+    const int W = size.width();
+    const int H = size.height();
+
+    if (layout == Layout::Window12)
+    {
+        const int topH    = t[1].height() + t[4].height();
+        const int bottomH = t[10].height();
+
+        const QRect inner = QRect(0, 0, W, H).adjusted(t[6].width(), topH,
+                                                       -t[8].width(), -bottomH);
+        if (!t[7].isNull())
+            sink.tile(t[7], inner);
+        else
+            geo.fill = inner;
+
+        // Goldleiste
+        sink.place(t[0], 0, 0);
+        sink.tile(t[1], QRect(t[0].width(), 0,
+                              W - t[0].width() - t[2].width(), t[1].height()));
+        sink.place(t[2], W - t[2].width(), 0);
+
+        // Header
+        const int headerY = t[1].height();
+        sink.place(t[3], 0, headerY);
+        sink.tile(t[4], QRect(t[3].width(), headerY,
+                              W - t[3].width() - t[5].width(), t[4].height()));
+        sink.place(t[5], W - t[5].width(), headerY);
+
+        // Seiten
+        const int sideTop    = headerY + t[4].height();
+        const int sideHeight = qMax(0, H - bottomH - sideTop);
+        sink.tile(t[6], QRect(0, sideTop, t[6].width(), sideHeight));
+        sink.tile(t[8], QRect(W - t[8].width(), sideTop, t[8].width(), sideHeight));
+
+        // Fuß
+        const int bottomY = H - bottomH;
+        sink.place(t[9], 0, bottomY);
+        sink.tile(t[10], QRect(t[9].width(), bottomY,
+                               W - t[9].width() - t[11].width(), t[10].height()));
+        sink.place(t[11], W - t[11].width(), bottomY);
+    }
+    else
+    {
+        const TextureRegion &tl = t[0], &tm = t[1], &tr = t[2];
+        const TextureRegion &ml = t[3], &mm = t[4], &mr = t[5];
+        const TextureRegion &bl = t[6], &bm = t[7], &br = t[8];
+
+        // Mitte über die ganze Fläche, Kanten und Ecken darüber
+        // (Positionen wie bisher an right()/bottom() ausgerichtet)
+        sink.tile(mm, QRect(0, 0, W, H));
+
+        sink.tile(tm, QRect(tl.width(), 0, W - tl.width() - tr.width(), tm.height()));
+        sink.tile(bm, QRect(bl.width(), H - 1 - bm.height(),
+                            W - bl.width() - br.width(), bm.height()));
+        sink.tile(ml, QRect(0, tl.height(), ml.width(), H - tl.height() - bl.height()));
+        sink.tile(mr, QRect(W - 1 - mr.width(), tr.height(),
+                            mr.width(), H - tr.height() - br.height()));
+
+        sink.place(tl, 0, 0);
+        sink.place(tr, W - 1 - tr.width(), 0);
+        sink.place(bl, 0, H - 1 - bl.height());
+        sink.place(br, W - 1 - br.width(), H - 1 - br.height());
+    }
+
+    return geo;
+}
+
+void SliceRenderer::paint(QPainter& p, const Geometry& geo)
+{
+    if (!geo.fill.isEmpty())
+        p.fillRect(geo.fill, QColor(30, 30, 30));
+
+    for (const Batch& batch : geo.batches)
+        p.drawPixmapFragments(batch.fragments.constData(),
+                              int(batch.fragments.size()), batch.page);
+}
+
+const SliceRenderer::Geometry& SliceRenderer::geometry(const Key& key,
+                                                       Layout layout,
+                                                       const TextureRegion* tiles)
+{
+    if (const Geometry* hit = m_geometry.object(key))
+        return *hit;
+
+    Geometry* geo = new Geometry(build(layout, tiles, key.size, key.alpha / 255.0));
+    m_geometry.insert(key, geo, 1);
+    return *geo;
+}
+
+// ------------------------------------------------------------
+// Zeichnen: fertiges Bild blitten, sonst einmal komponieren
+// ------------------------------------------------------------
+void SliceRenderer::draw(QPainter& p, const QRect& target, Layout layout,
+                         const TextureRegion* tiles, qreal opacity)
+{
+    if (!tiles || target.isEmpty())
+        return;
+
+    const qreal dpr = p.device() ? p.device()->devicePixelRatioF() : 1.0;
+
+    Key key;
+    fillSkin(key, layout, tiles);
+    key.size  = target.size();
+    key.scale = qRound(dpr * 100);
+    key.alpha = qBound(0, qRound(opacity * 255), 255);
+
+    if (const QPixmap* composed = m_composed.object(key)) {
+        ++m_hits;
+        p.drawPixmap(target.topLeft(), *composed);
+        return;
+    }
+
+    ++m_misses;
+
+    const Geometry& geo = geometry(key, layout, tiles);
+
+    QPixmap composed(target.size() * dpr);
+    composed.setDevicePixelRatio(dpr);
+    composed.fill(Qt::transparent);
+    {
+        QPainter cp(&composed);
+        paint(cp, geo);
+    }
+
+    p.drawPixmap(target.topLeft(), composed);
+
+    m_composed.insert(key, new QPixmap(composed), PixmapCost::kib(composed));
+}
+
+} // namespace RenderHelpers
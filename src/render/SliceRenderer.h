@@ -0,0 +1,122 @@
+#pragma once
+
+#include <QCache>
+#include <QHashFunctions>
+#include <array>
+#include <QList>
+#include <QPainter>
+#include <QPixmap>
+#include <QRect>
+
+#include "TextureAtlas.h"
+
+// ------------------------------------------------------------
+// SliceRenderer – Nine-/Twelve-Slice für Fenster- und Edit-Skins
+// ------------------------------------------------------------
+//  - Layout::Window12: Fenster-Tileset 00–11 (07 = Mitte, fehlt
+//    sie, wird dunkel gefüllt)
+//  - Layout::Edit9:    Edit-Tileset 00–08 (04 = Mitte, über das
+//    ganze Rechteck gekachelt und darauf beschnitten)
+//
+//  opacity wird beim Komponieren pro Fragment gesetzt (überlappende
+//  Tiles mischen wie beim direkten Zeichnen); das fertige Bild wird
+//  mit der Painter-Opacity des Aufrufers geblittet.
+//
+//  Die Patch-Geometrie (Kacheln inkl. beschnittener Ränder) wird
+//  einmal pro (Skin, Größe) berechnet und mit einem
+//  drawPixmapFragments-Aufruf pro Atlas-Seite gezeichnet (im
+//  Normalfall liegen alle Tiles auf einer Seite → ein Aufruf).
+//  Zusätzlich wird das fertige Bild pro (Skin, Größe) als QPixmap
+//  gehalten; bei unveränderter Größe ist ein Repaint ein Blit.
+//
+//  Der Skin wird über Atlas-Seite (cacheKey) + Teilrechteck jedes
+//  Tiles identifiziert (vollständig im Schlüssel, kein Hash).
+//  Gehört dem ThemeManager, der ihn bei texturesUpdated/themeChanged
+//  leert – sonst hielten die Batches alte Atlas-Seiten fest.
+//  Nur GUI-Thread (QPixmap).
+// ------------------------------------------------------------
+namespace RenderHelpers
+{
+
+class SliceRenderer
+{
+public:
+    enum class Layout { Window12, Edit9 };
+
+    static constexpr qint64 kDefaultBudget = 16 * 1024 * 1024;
+    static constexpr int    kMaxTiles      = 12;
+
+    SliceRenderer();
+
+    SliceRenderer(const SliceRenderer&) = delete;
+    SliceRenderer& operator=(const SliceRenderer&) = delete;
+
+    // tiles: 12 (Window12) bzw. 9 (Edit9) Regionen, null = fehlt
+    void draw(QPainter& p, const QRect& target, Layout layout,
+              const TextureRegion* tiles, qreal opacity = 1.0);
+
+    void setBudget(qint64 bytes);
+    void clear();
+
+    int hits() const   { return m_hits; }
+    int misses() const { return m_misses; }
+
+    // Ein Tile: Atlas-Seite + Teilrechteck (null → 0 / leer)
+    struct TileKey {
+        qint64 page = 0;
+        QRect  rect;
+
+        bool operator==(const TileKey& o) const { return page == o.page && rect == o.rect; }
+    };
+
+    struct Key {
+        Layout layout = Layout::Window12;
+        std::array<TileKey, kMaxTiles> tiles {};   // Edit9: nur 0–8 belegt
+        QSize  size;
+        int    scale = 100;    // devicePixelRatio × 100
+        int    alpha = 255;    // opacity × 255
+
+        bool operator==(const Key& o) const
+        {
+            return layout == o.layout && tiles == o.tiles
+                && size == o.size && scale == o.scale && alpha == o.alpha;
+        }
+    };
+
+    // Vorberechnete Fragmente, gruppiert nach Atlas-Seite
+    struct Batch {
+        QPixmap page;
+        QList<QPainter::PixmapFragment> fragments;
+    };
+
+    struct Geometry {
+        QRect fill;            // Fenster ohne Mitte: dunkel füllen
+        QList<Batch> batches;  // Zeichenreihenfolge bleibt erhalten
+    };
+
+private:
+    static int tileCount(Layout layout) { return layout == Layout::Window12 ? 12 : 9; }
+    static void fillSkin(Key& key, Layout layout, const TextureRegion* tiles);
+    static Geometry build(Layout layout, const TextureRegion* tiles,
+                          const QSize& size, qreal opacity);
+    static void paint(QPainter& p, const Geometry& geo);
+
+    const Geometry& geometry(const Key& key, Layout layout,
+                             const TextureRegion* tiles);
+
+    QCache<Key, Geometry> m_geometry;
+    QCache<Key, QPixmap>  m_composed;     // Kosten in KiB
+    int m_hits   = 0;
+    int m_misses = 0;
+};
+
+inline size_t qHash(const SliceRenderer::Key& key, size_t seed = 0)
+{
+    seed = qHashMulti(seed, int(key.layout), key.size.width(), key.size.height(),
+                      key.scale, key.alpha);
+    for (const SliceRenderer::TileKey& t : key.tiles)
+        seed = qHashMulti(seed, t.page, t.rect.x(), t.rect.y(), t.rect.width(), t.rect.height());
+    return seed;
+}
+
+} // namespace RenderHelpers
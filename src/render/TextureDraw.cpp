@@ -0,0 +1,30 @@
+#include "render/TextureDraw.h"
+
+namespace RenderHelpers
+{
+
+void drawRegion(QPainter& p, const QPoint& pos, const TextureRegion& tex)
+{
+    if (tex.isNull())
+        return;
+
+    p.drawPixmap(pos, tex.page, tex.rect);
+}
+
+void drawRegion(QPainter& p, const QRect& target, const TextureRegion& tex)
+{
+    if (tex.isNull() || target.isEmpty())
+        return;
+
+    if (target.size() == tex.size()) {
+        p.drawPixmap(target.topLeft(), tex.page, tex.rect);
+        return;
+    }
+
+    const bool smooth = p.testRenderHint(QPainter::SmoothPixmapTransform);
+    p.setRenderHint(QPainter::SmoothPixmapTransform, true);
+    p.drawPixmap(target, tex.page, tex.rect);
+    p.setRenderHint(QPainter::SmoothPixmapTransform, smooth);
+}
+
+} // namespace RenderHelpers
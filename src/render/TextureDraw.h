@@ -0,0 +1,24 @@
+#pragma once
+
+#include <QPainter>
+#include <QRect>
+
+#include "TextureAtlas.h"
+
+// ------------------------------------------------------------
+// Zeichnen von TextureRegions (Atlas-Teilrechtecke)
+// ------------------------------------------------------------
+//  Gekachelte Flächen (Fenster-/Edit-Skins) zeichnet der
+//  SliceRenderer über drawPixmapFragments.
+// ------------------------------------------------------------
+namespace RenderHelpers
+{
+// 1:1 an Position
+void drawRegion(QPainter& p, const QPoint& pos, const TextureRegion& tex);
+
+// Auf Zielrechteck gestreckt (bilinear). Achtung: der Atlas hat
+// keinen Rand zwischen den Teilrechtecken, gestreckt sampelt Qt die
+// Nachbar-Texel mit. Gestreckte Texturen daher über
+// ThemeManager::scaledTexture zeichnen; hier nur bei gleicher Größe.
+void drawRegion(QPainter& p, const QRect& target, const TextureRegion& tex);
+}
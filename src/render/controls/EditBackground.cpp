@@ -1,6 +1,7 @@
 #include "render/controls/EditBackground.h"
 #include "layout/ControlLayout.h"
 #include "theme/ThemeManager.h"
+#include "render/SliceRenderer.h"
 
 namespace RenderHelpers
 {
@@ -15,31 +16,41 @@ void drawEditBackground(QPainter& p,
 
     p.save();
 
-    // FlyFF EditBox Alpha
+    // FlyFF EditBox Alpha (Skin: pro Tile im SliceRenderer)
     constexpr qreal FLYFF_WINDOW_ALPHA = 200.0 / 255.0;
-    p.setOpacity(FLYFF_WINDOW_ALPHA);
     p.setCompositionMode(QPainter::CompositionMode_SourceOver);
 
     //
     // 1) Tileset-Prefix automatisch erkennen
+    //    (Namen nur einmal aufbauen, danach reine Handle-Lookups)
     //
-    const QStringList candidates = {
-        "wndedittile",
-        "edit"
+    struct EditTileKeys {
+        QString names[2][9];
     };
 
-    QString prefix;
+    static const EditTileKeys keys = [] {
+        const char* candidates[2] = {
+            "wndedittile",
+            "edit"
+        };
 
-    for (const QString& c : candidates)
-    {
-        QString k = QString("%1%2")
-        .arg(c)
-            .arg(0, 2, 10, QChar('0'));
+        EditTileKeys k;
+        for (int c = 0; c < 2; ++c)
+            for (int i = 0; i < 9; ++i)
+                k.names[c][i] = QString("%1%2")
+                                    .arg(QLatin1String(candidates[c]))
+                                    .arg(i, 2, 10, QChar('0'));
+        return k;
+    }();
+
+    int set = -1;
 
-        QPixmap test = theme->texture(k, info.state);
+    for (int c = 0; c < 2; ++c)
+    {
+        const ThemeManager::TextureId id = theme->textureId(keys.names[c][0]);
 
-        if (!test.isNull()) {
-            prefix = c;
+        if (!theme->texture(id, info.state).isNull()) {
+            set = c;
             break;
         }
     }
@@ -47,8 +58,9 @@ void drawEditBackground(QPainter& p,
     //
     // 2) Falls kein Tileset → Fallback
     //
-    if (prefix.isEmpty())
+    if (set < 0)
     {
+        p.setOpacity(FLYFF_WINDOW_ALPHA);
         p.fillRect(rect, QColor(20,20,20));
         p.setPen(QColor(0,0,0,150));
         p.drawRect(rect.adjusted(0,0,-1,-1));
@@ -57,90 +69,18 @@ void drawEditBackground(QPainter& p,
     }
 
     //
-    // 3) Tiles holen
+    // 3) Tiles holen (texture() liefert Kopien, die Reihenfolge der
+    //    textureId()-Aufrufe spielt keine Rolle)
     //
-    auto getTile = [&](int idx) -> QPixmap {
-        QString key = QString("%1%2")
-        .arg(prefix)
-            .arg(idx, 2, 10, QChar('0'));
-        return theme->texture(key, info.state);
-    };
-
-    QPixmap tl = getTile(0);
-    QPixmap tm = getTile(1);
-    QPixmap tr = getTile(2);
-    QPixmap ml = getTile(3);
-    QPixmap mm = getTile(4);
-    QPixmap mr = getTile(5);
-    QPixmap bl = getTile(6);
-    QPixmap bm = getTile(7);
-    QPixmap br = getTile(8);
+    TextureRegion tiles[9];
+    for (int i = 0; i < 9; ++i)
+        tiles[i] = theme->texture(theme->textureId(keys.names[set][i]), info.state);
 
     //
-    // 4) Tilegröße (Fallback falls mm leer ist)
+    // 4) Mitte, Kanten, Ecken: Geometrie + fertiges Bild gecacht
     //
-    int tileW = mm.isNull() ? 4 : mm.width();
-    int tileH = mm.isNull() ? 4 : mm.height();
-
-    //
-    // 5) Mitte tiled füllen
-    //
-    for (int y = rect.top(); y < rect.bottom(); y += tileH)
-        for (int x = rect.left(); x < rect.right(); x += tileW)
-            p.drawPixmap(QRect(x, y, tileW, tileH), mm);
-
-    //
-    // 6) Kanten
-    //
-    if (!tm.isNull())
-        p.drawTiledPixmap(
-            QRect(rect.left() + tl.width(),
-                  rect.top(),
-                  rect.width() - tl.width() - tr.width(),
-                  tm.height()),
-            tm
-            );
-
-    if (!bm.isNull())
-        p.drawTiledPixmap(
-            QRect(rect.left() + bl.width(),
-                  rect.bottom() - bm.height(),
-                  rect.width() - bl.width() - br.width(),
-                  bm.height()),
-            bm
-            );
-
-    if (!ml.isNull())
-        p.drawTiledPixmap(
-            QRect(rect.left(),
-                  rect.top() + tl.height(),
-                  ml.width(),
-                  rect.height() - tl.height() - bl.height()),
-            ml
-            );
-
-    if (!mr.isNull())
-        p.drawTiledPixmap(
-            QRect(rect.right() - mr.width(),
-                  rect.top() + tr.height(),
-                  mr.width(),
-                  rect.height() - tr.height() - br.height()),
-            mr
-            );
-
-    //
-    // 7) Ecken
-    //
-    if (!tl.isNull()) p.drawPixmap(rect.topLeft(), tl);
-
-    if (!tr.isNull())
-        p.drawPixmap(rect.topRight() - QPoint(tr.width(), 0), tr);
-
-    if (!bl.isNull())
-        p.drawPixmap(rect.bottomLeft() - QPoint(0, bl.height()), bl);
-
-    if (!br.isNull())
-        p.drawPixmap(rect.bottomRight() - QPoint(br.width(), br.height()), br);
+    theme->sliceRenderer().draw(
+        p, rect, RenderHelpers::SliceRenderer::Layout::Edit9, tiles, FLYFF_WINDOW_ALPHA);
 
     p.restore();
 }
@@ -11,14 +11,15 @@ void RenderButton::render(QPainter& p,
 {
     const QRect rect = info.renderRect;
 
-    QString texName = info.data->texture.toLower().trimmed();
-    if (texName.isEmpty())
+    // Handle statt Stringaufbereitung (nach dem ersten Frame nur ein Hash-Lookup)
+    const ThemeManager::TextureId texId = theme->textureId(info.data->texture);
+    if (texId == ThemeManager::kNoTexture)
     {
         p.fillRect(rect, Qt::gray);
         return;
     }
 
-    QPixmap pm = theme->texture(texName, info.state);
+    const TextureRegion pm = theme->texture(texId, info.state);
     if (pm.isNull())
     {
         p.fillRect(rect, Qt::red);
@@ -26,9 +27,7 @@ void RenderButton::render(QPainter& p,
     }
 
     // ✔️ CLIENT-RENDER: Full stretch des Buttons
-    p.drawPixmap(rect, pm.scaled(rect.size(),
-                                 Qt::IgnoreAspectRatio,
-                                 Qt::SmoothTransformation));
+    p.drawPixmap(rect.topLeft(), theme->scaledTexture(texId, info.state, rect.size()));
 }
 
 // -------------------------------------
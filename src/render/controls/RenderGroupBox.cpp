@@ -17,20 +17,17 @@ void RenderGroupBox::render(QPainter& p,
 
     auto ctrl = info.data;
 
-    // 1) Textur aus Control lesen
-    QString texName = ctrl->texture.trimmed().toLower();
+    // 1) Textur aus Control lesen (Handle)
+    const ThemeManager::TextureId texId = theme->textureId(ctrl->texture);
 
     // 2) Falls Textur gesetzt → ThemeManager nutzen
-    if (!texName.isEmpty())
+    if (texId != ThemeManager::kNoTexture)
     {
-        QPixmap pm = theme->texture(texName, ControlState::Normal);
+        const TextureRegion pm = theme->texture(texId, ControlState::Normal);
 
         if (!pm.isNull())
         {
-            p.drawPixmap(rect,
-                         pm.scaled(rect.size(),
-                                   Qt::IgnoreAspectRatio,
-                                   Qt::SmoothTransformation));
+            p.drawPixmap(rect.topLeft(), theme->scaledTexture(texId, ControlState::Normal, rect.size()));
             return;
         }
     }
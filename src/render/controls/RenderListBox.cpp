@@ -11,16 +11,14 @@ void RenderListBox::render(QPainter& p,
     const QRect& rect = info.renderRect;
     auto ctrl = info.data;
 
-    QString tex = ctrl->texture.trimmed().toLower();
+    const ThemeManager::TextureId texId = theme->textureId(ctrl->texture);
 
-    if (!tex.isEmpty())
+    if (texId != ThemeManager::kNoTexture)
     {
-        QPixmap pm = theme->texture(tex, ControlState::Normal);
+        const TextureRegion pm = theme->texture(texId, ControlState::Normal);
         if (!pm.isNull())
         {
-            p.drawPixmap(rect, pm.scaled(rect.size(),
-                                         Qt::IgnoreAspectRatio,
-                                         Qt::SmoothTransformation));
+            p.drawPixmap(rect.topLeft(), theme->scaledTexture(texId, ControlState::Normal, rect.size()));
             return;
         }
     }
@@ -4,6 +4,7 @@
 #include "ProjectController.h"
 #include "behavior/BehaviorEngine.h"
 #include "WindowData.h"
+#include "utils/Profiler.h"
 #include <QPainter>
 #include <QMouseEvent>
 #include <QDebug>
@@ -16,6 +17,7 @@ Canvas::Canvas(ProjectController* controller, QWidget* parent)
 {
     setMinimumSize(800, 600);
     setMouseTracking(true);
+    connectBehaviorEngine();
 
     qInfo() << "[Canvas] Initialized with RenderManager:"
             << (m_renderManager ? "OK" : "null")
@@ -25,12 +27,29 @@ Canvas::Canvas(ProjectController* controller, QWidget* parent)
 
 void Canvas::setEngines(RenderManager* rm, BehaviorEngine* be)
 {
+    if (m_behaviorEngine)
+        disconnect(m_behaviorEngine, nullptr, this, nullptr);
+
     m_renderManager = rm;
     m_behaviorEngine = be;
+    connectBehaviorEngine();
+}
+
+// Hover/Pressed → nur das betroffene Rechteck neu zeichnen
+void Canvas::connectBehaviorEngine()
+{
+    if (!m_behaviorEngine)
+        return;
+
+    m_behaviorEngine->setCanvasSize(size());
+    m_behaviorEngine->setActiveWindow(m_activeWindow);
+    connect(m_behaviorEngine, &BehaviorEngine::controlStateChanged,
+            this, [this](const QRect& area) { update(area); });
 }
 
 void Canvas::paintEvent(QPaintEvent*)
 {
+    FLYFF_PROFILE_SCOPE("paintEvent", "frame");
     QPainter painter(this);
 
     if (m_renderManager && m_activeWindow) {
@@ -46,6 +65,8 @@ void Canvas::paintEvent(QPaintEvent*)
 void Canvas::setActiveWindow(const std::shared_ptr<WindowData>& wnd)
 {
     m_activeWindow = wnd;
+    if (m_behaviorEngine)
+        m_behaviorEngine->setActiveWindow(wnd);
     update();
 }
 
@@ -67,6 +88,13 @@ void Canvas::mouseReleaseEvent(QMouseEvent* event)
         m_behaviorEngine->mouseRelease(event->pos(), event->button(), event->modifiers());
 }
 
+void Canvas::resizeEvent(QResizeEvent* event)
+{
+    QWidget::resizeEvent(event);
+    if (m_behaviorEngine)
+        m_behaviorEngine->setCanvasSize(size());
+}
+
 void Canvas::leaveEvent(QEvent* event)
 {
     Q_UNUSED(event);
@@ -22,6 +22,7 @@ protected:
     void mouseMoveEvent(QMouseEvent* event) override;
     void mouseReleaseEvent(QMouseEvent* event) override;
     void leaveEvent(QEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
 
 private:
     ProjectController* m_controller = nullptr;
@@ -29,4 +30,6 @@ private:
     BehaviorEngine*    m_behaviorEngine = nullptr; // nur Zeiger, Ownership beim Controller
 
     std::shared_ptr<WindowData> m_activeWindow;
+
+    void connectBehaviorEngine();
 };
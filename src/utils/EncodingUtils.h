@@ -2,11 +2,40 @@
 #include <QFile>
 #include <QTextStream>
 #include <QByteArray>
+#include <QByteArrayView>
 #include <QStringConverter>
+#include <QStringDecoder>
+#include <QStringEncoder>
+#include <QSaveFile>
+#include <QStringView>
 #include <QDebug>
 
 namespace EncodingUtils {
 
+// Chunkgröße (Bytes) für das gestreamte Dekodieren
+inline constexpr qsizetype kDecodeChunkSize = 64 * 1024;
+
+// Puffergröße (Bytes) für das gestreamte Kodieren
+inline constexpr qsizetype kEncodeBufferSize = 64 * 1024;
+
+struct DetectedEncoding {
+    QStringConverter::Encoding encoding = QStringConverter::Utf8;
+    qsizetype bomSize = 0;
+    const char* label = "UTF-8 (kein BOM) angenommen:";
+};
+
+// BOM-Erkennung (gemeinsam für QTextStream- und Mapped-Pfad)
+inline DetectedEncoding detectEncoding(QByteArrayView head)
+{
+    if (head.startsWith("\xFF\xFE"))
+        return { QStringConverter::Utf16, 2, "UTF-16 LE erkannt:" };
+    if (head.startsWith("\xFE\xFF"))
+        return { QStringConverter::Utf16BE, 2, "UTF-16 BE erkannt:" };
+    if (head.startsWith("\xEF\xBB\xBF"))
+        return { QStringConverter::Utf8, 3, "UTF-8 BOM erkannt:" };
+    return {};
+}
+
 inline bool openTextStream(QFile &file, QTextStream &stream, const QString &path)
 {
     file.setFileName(path);
@@ -20,24 +49,206 @@ inline bool openTextStream(QFile &file, QTextStream &stream, const QString &path
         return false;
     }
 
-    QByteArray head = file.peek(4);
-    if (head.startsWith("\xFF\xFE")) {
-        stream.setEncoding(QStringConverter::Utf16);
-        qInfo() << "[EncodingUtils] UTF-16 LE erkannt:" << path;
-    } else if (head.startsWith("\xFE\xFF")) {
-        stream.setEncoding(QStringConverter::Utf16BE);
-        qInfo() << "[EncodingUtils] UTF-16 BE erkannt:" << path;
-    } else if (head.startsWith("\xEF\xBB\xBF")) {
-        stream.setEncoding(QStringConverter::Utf8);
-        qInfo() << "[EncodingUtils] UTF-8 BOM erkannt:" << path;
+    const DetectedEncoding detected = detectEncoding(file.peek(4));
+    stream.setEncoding(detected.encoding);
+    qInfo() << "[EncodingUtils]" << detected.label << path;
+
+    stream.setDevice(&file);
+
+    return true;
+}
+
+// ------------------------------------------------------------
+// Datei per QFile::map einblenden und in festen Chunks dekodieren.
+// sink(QStringView) erhält jeden dekodierten Chunk; die View ist nur
+// während des Aufrufs gültig (der Puffer wird wiederverwendet).
+// Es entsteht keine vollständige UTF-16-Kopie der Datei.
+// Fällt auf gepuffertes read() zurück, wenn map() nicht möglich ist.
+// ------------------------------------------------------------
+template <typename ChunkSink>
+inline bool decodeFileChunked(const QString& path,
+                              ChunkSink&& sink,
+                              qsizetype chunkSize = kDecodeChunkSize)
+{
+    QFile file(path);
+
+    if (!file.exists()) {
+        qWarning() << "[EncodingUtils] Datei nicht gefunden:" << path;
+        return false;
+    }
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "[EncodingUtils] Datei konnte nicht geöffnet werden:" << path;
+        return false;
+    }
+
+    const qint64 size = file.size();
+    uchar* mapped = size > 0 ? file.map(0, size) : nullptr;
+
+    const DetectedEncoding detected = mapped
+        ? detectEncoding(QByteArrayView(mapped, qMin<qint64>(size, 4)))
+        : detectEncoding(file.peek(4));
+    qInfo() << "[EncodingUtils]" << detected.label << path;
+
+    // Default-Flags: ein evtl. verbliebener BOM wird vom Decoder verworfen
+    QStringDecoder decoder(detected.encoding);
+
+    QString buffer;
+    buffer.resize(decoder.requiredSpace(chunkSize));
+
+    auto decodeChunk = [&](QByteArrayView bytes) {
+        QChar* begin = buffer.data();
+        QChar* end   = decoder.appendToBuffer(begin, bytes);
+        if (end != begin)
+            sink(QStringView(begin, end - begin));
+    };
+
+    if (mapped) {
+        for (qint64 pos = detected.bomSize; pos < size; pos += chunkSize) {
+            const qint64 len = qMin<qint64>(chunkSize, size - pos);
+            decodeChunk(QByteArrayView(mapped + pos, len));
+        }
+        file.unmap(mapped);
     } else {
-        stream.setEncoding(QStringConverter::Utf8);
-        qInfo() << "[EncodingUtils] UTF-8 (kein BOM) angenommen:" << path;
+        file.seek(detected.bomSize);
+
+        QByteArray chunk(chunkSize, Qt::Uninitialized);
+        qint64 n = 0;
+        while ((n = file.read(chunk.data(), chunkSize)) > 0)
+            decodeChunk(QByteArrayView(chunk.constData(), n));
     }
 
-    stream.setDevice(&file);
+    if (decoder.hasError())
+        qWarning() << "[EncodingUtils] Ungültige Zeichenfolge beim Dekodieren:" << path;
 
     return true;
 }
 
+// BOM einer bestehenden Datei ermitteln (für das Zurückschreiben)
+inline bool detectFileEncoding(const QString& path, DetectedEncoding& out)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    out = detectEncoding(file.peek(4));
+    return true;
+}
+
+// ------------------------------------------------------------
+// TextFileWriter – atomarer, gepufferter Text-Writer
+// ------------------------------------------------------------
+//  - Kodiert direkt in die Zielkodierung (kein QString der
+//    ganzen Datei, kein zweiter QByteArray)
+//  - Übernimmt Kodierung + BOM der bestehenden Zieldatei,
+//    sonst die übergebene Vorgabe
+//  - Schreibt über QSaveFile in eine temporäre Datei; erst
+//    commit() ersetzt das Ziel per Rename. Abbruch oder Absturz
+//    lassen die alte Datei unverändert.
+// ------------------------------------------------------------
+class TextFileWriter
+{
+public:
+    explicit TextFileWriter(const QString& path)
+        : m_file(path)
+    {}
+
+    bool open(const DetectedEncoding& fallback = {})
+    {
+        m_encoding = fallback;
+        detectFileEncoding(m_file.fileName(), m_encoding);
+
+        // Schreibrichtung explizit festlegen (Utf16 = Host-Byteorder)
+        QStringConverter::Encoding target = m_encoding.encoding;
+        if (target == QStringConverter::Utf16)
+            target = QStringConverter::Utf16LE;
+
+        m_encoder = QStringEncoder(target, m_encoding.bomSize > 0
+                                               ? QStringConverter::Flag::WriteBom
+                                               : QStringConverter::Flag::Default);
+        m_buffer.resize(kEncodeBufferSize);
+        m_used   = 0;
+        m_failed = false;
+
+        if (!m_file.open(QIODevice::WriteOnly)) {
+            qWarning() << "[EncodingUtils] Datei konnte nicht geschrieben werden:"
+                       << m_file.fileName() << m_file.errorString();
+            m_failed = true;
+            return false;
+        }
+        return true;
+    }
+
+    void write(QStringView text)
+    {
+        if (m_failed || text.isEmpty())
+            return;
+
+        const qsizetype need = m_encoder.requiredSpace(text.size());
+        if (m_used + need > m_buffer.size()) {
+            flush();
+            if (need > m_buffer.size())
+                m_buffer.resize(need);
+        }
+
+        char* end = m_encoder.appendToBuffer(m_buffer.data() + m_used, text);
+        m_used = end - m_buffer.data();
+    }
+
+    TextFileWriter& operator<<(QStringView text) { write(text); return *this; }
+
+    // Puffer leeren und Ziel atomar ersetzen
+    bool commit()
+    {
+        // open() fehlgeschlagen (oder nie aufgerufen) → nichts zu verwerfen
+        if (!m_file.isOpen())
+            return false;
+
+        flush();
+
+        if (m_encoder.hasError()) {
+            qWarning() << "[EncodingUtils] Zeichen nicht kodierbar:" << m_file.fileName();
+            m_failed = true;
+        }
+
+        if (m_failed) {
+            m_file.cancelWriting();
+            m_file.commit();
+            return false;
+        }
+
+        if (!m_file.commit()) {
+            qWarning() << "[EncodingUtils] Speichern fehlgeschlagen:"
+                       << m_file.fileName() << m_file.errorString();
+            return false;
+        }
+
+        qInfo() << "[EncodingUtils] Gespeichert:" << m_file.fileName();
+        return true;
+    }
+
+    bool hasError() const { return m_failed; }
+    const DetectedEncoding& encoding() const { return m_encoding; }
+
+private:
+    void flush()
+    {
+        if (m_failed || m_used == 0)
+            return;
+
+        if (m_file.write(m_buffer.constData(), m_used) != m_used) {
+            qWarning() << "[EncodingUtils] Schreibfehler:"
+                       << m_file.fileName() << m_file.errorString();
+            m_failed = true;
+        }
+        m_used = 0;
+    }
+
+    QSaveFile        m_file;
+    QStringEncoder   m_encoder;
+    DetectedEncoding m_encoding;
+    QByteArray       m_buffer;
+    qsizetype        m_used   = 0;
+    bool             m_failed = false;
+};
+
 } // namespace EncodingUtils
@@ -0,0 +1,279 @@
+#include "utils/PixelKernels.h"
+
+#include <atomic>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  define FLYFF_PIXEL_X86 1
+#  include <immintrin.h>
+#  if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#    define FLYFF_TARGET(isa)
+#  else
+#    define FLYFF_TARGET(isa) __attribute__((target(isa)))
+#  endif
+#else
+#  define FLYFF_PIXEL_X86 0
+#endif
+
+namespace PixelKernels {
+
+namespace {
+
+// ------------------------------------------------------------
+// Scalar (Referenz + Reste der SIMD-Schleifen)
+// ------------------------------------------------------------
+void bgr24Scalar(const uchar* src, QRgb* dst, int count)
+{
+    for (int x = 0; x < count; ++x, src += 3)
+        dst[x] = qRgb(src[2], src[1], src[0]);
+}
+
+void bgra32Scalar(const uchar* src, QRgb* dst, int count)
+{
+    for (int x = 0; x < count; ++x, src += 4)
+        dst[x] = qRgba(src[2], src[1], src[0], src[3]);
+}
+
+void keyScalar(QRgb* line, int count)
+{
+    for (int x = 0; x < count; ++x) {
+        if ((line[x] & 0x00FFFFFFu) == 0x00FF00FFu)
+            line[x] = 0u;
+    }
+}
+
+const Kernels kScalar = { bgr24Scalar, bgra32Scalar, keyScalar };
+
+#if FLYFF_PIXEL_X86
+
+// x86 ist little-endian: B,G,R,A im Speicher == ARGB32 als uint32.
+// 32-Bit-TGA-Zeilen sind damit eine reine Kopie.
+void bgra32Copy(const uchar* src, QRgb* dst, int count)
+{
+    std::memcpy(dst, src, size_t(count) * 4);
+}
+
+// ------------------------------------------------------------
+// SSE2
+// ------------------------------------------------------------
+FLYFF_TARGET("sse2")
+void keySse2(QRgb* line, int count)
+{
+    const __m128i rgbMask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i magenta = _mm_set1_epi32(0x00FF00FF);
+
+    int x = 0;
+    for (; x + 4 <= count; x += 4) {
+        __m128i* p = reinterpret_cast<__m128i*>(line + x);
+        const __m128i px = _mm_loadu_si128(p);
+        const __m128i eq = _mm_cmpeq_epi32(_mm_and_si128(px, rgbMask), magenta);
+        _mm_storeu_si128(p, _mm_andnot_si128(eq, px));
+    }
+
+    keyScalar(line + x, count - x);
+}
+
+// ------------------------------------------------------------
+// SSSE3 – pshufb für 24-Bit
+// ------------------------------------------------------------
+FLYFF_TARGET("ssse3")
+void bgr24Ssse3(const uchar* src, QRgb* dst, int count)
+{
+    // je 3 Byte → 4 Byte, das 4. Byte (Alpha) wird genullt und danach gesetzt
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128,
+                                          6, 7, 8, -128, 9, 10, 11, -128);
+    const __m128i alpha   = _mm_set1_epi32(int(0xFF000000u));
+
+    // 16-Byte-Load für 12 Byte Nutzdaten → mindestens 6 Pixel Rest
+    int x = 0;
+    for (; x + 6 <= count; x += 4, src += 12) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x),
+                         _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alpha));
+    }
+
+    bgr24Scalar(src, dst + x, count - x);
+}
+
+// ------------------------------------------------------------
+// AVX2
+// ------------------------------------------------------------
+FLYFF_TARGET("avx2")
+void bgr24Avx2(const uchar* src, QRgb* dst, int count)
+{
+    // vpshufb arbeitet pro 128-Bit-Lane → je Lane 4 Pixel
+    const __m256i shuffle = _mm256_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128,
+                                             6, 7, 8, -128, 9, 10, 11, -128,
+                                             0, 1, 2, -128, 3, 4, 5, -128,
+                                             6, 7, 8, -128, 9, 10, 11, -128);
+    const __m256i alpha   = _mm256_set1_epi32(int(0xFF000000u));
+
+    // Zweiter Load endet bei Byte 28 → mindestens 10 Pixel Rest
+    int x = 0;
+    for (; x + 10 <= count; x += 8, src += 24) {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12));
+        const __m256i v  = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x),
+                            _mm256_or_si256(_mm256_shuffle_epi8(v, shuffle), alpha));
+    }
+
+    bgr24Scalar(src, dst + x, count - x);
+}
+
+FLYFF_TARGET("avx2")
+void keyAvx2(QRgb* line, int count)
+{
+    const __m256i rgbMask = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i magenta = _mm256_set1_epi32(0x00FF00FF);
+
+    int x = 0;
+    for (; x + 8 <= count; x += 8) {
+        __m256i* p = reinterpret_cast<__m256i*>(line + x);
+        const __m256i px = _mm256_loadu_si256(p);
+        const __m256i eq = _mm256_cmpeq_epi32(_mm256_and_si256(px, rgbMask), magenta);
+        _mm256_storeu_si256(p, _mm256_andnot_si256(eq, px));
+    }
+
+    keySse2(line + x, count - x);
+}
+
+// SSE2 hat kein pshufb → 24-Bit bleibt skalar
+const Kernels kSse2  = { bgr24Scalar, bgra32Copy, keySse2 };
+const Kernels kSsse3 = { bgr24Ssse3,  bgra32Copy, keySse2 };
+const Kernels kAvx2  = { bgr24Avx2,   bgra32Copy, keyAvx2 };
+
+// ------------------------------------------------------------
+// CPU-Erkennung
+// ------------------------------------------------------------
+struct CpuFeatures {
+    bool sse2  = false;
+    bool ssse3 = false;
+    bool avx2  = false;
+};
+
+CpuFeatures detectCpu()
+{
+    CpuFeatures f;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4] = {};
+    __cpuid(regs, 0);
+    const int maxLeaf = regs[0];
+
+    __cpuid(regs, 1);
+    f.sse2  = (regs[3] & (1 << 26)) != 0;
+    f.ssse3 = (regs[2] & (1 << 9))  != 0;
+
+    // AVX2 braucht zusätzlich OS-Unterstützung für YMM (OSXSAVE + XCR0)
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    if (maxLeaf >= 7 && osxsave && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(regs, 7, 0);
+        f.avx2 = (regs[1] & (1 << 5)) != 0;
+    }
+#else
+    // prüft bei AVX auch die OS-Unterstützung (XGETBV)
+    __builtin_cpu_init();
+    f.sse2  = __builtin_cpu_supports("sse2");
+    f.ssse3 = __builtin_cpu_supports("ssse3");
+    f.avx2  = __builtin_cpu_supports("avx2");
+#endif
+
+    return f;
+}
+
+const CpuFeatures& cpu()
+{
+    static const CpuFeatures features = detectCpu();
+    return features;
+}
+
+#endif // FLYFF_PIXEL_X86
+
+std::atomic<const Kernels*> g_active    { nullptr };
+std::atomic<Isa>            g_activeIsa { Isa::Scalar };
+
+} // namespace
+
+bool supported(Isa isa)
+{
+#if FLYFF_PIXEL_X86
+    switch (isa) {
+    case Isa::Scalar: return true;
+    case Isa::Sse2:   return cpu().sse2;
+    case Isa::Ssse3:  return cpu().ssse3;
+    case Isa::Avx2:   return cpu().avx2;
+    }
+    return false;
+#else
+    return isa == Isa::Scalar;
+#endif
+}
+
+Isa bestIsa()
+{
+    for (Isa isa : { Isa::Avx2, Isa::Ssse3, Isa::Sse2 }) {
+        if (supported(isa))
+            return isa;
+    }
+    return Isa::Scalar;
+}
+
+const char* isaName(Isa isa)
+{
+    switch (isa) {
+    case Isa::Scalar: return "scalar";
+    case Isa::Sse2:   return "sse2";
+    case Isa::Ssse3:  return "ssse3";
+    case Isa::Avx2:   return "avx2";
+    }
+    return "unknown";
+}
+
+const Kernels& kernels(Isa isa)
+{
+    if (!supported(isa))
+        return kScalar;
+
+#if FLYFF_PIXEL_X86
+    switch (isa) {
+    case Isa::Scalar: return kScalar;
+    case Isa::Sse2:   return kSse2;
+    case Isa::Ssse3:  return kSsse3;
+    case Isa::Avx2:   return kAvx2;
+    }
+#endif
+    return kScalar;
+}
+
+const Kernels& active()
+{
+    const Kernels* k = g_active.load(std::memory_order_acquire);
+    if (!k) {
+        const Isa isa = bestIsa();
+        k = &kernels(isa);
+        g_activeIsa.store(isa, std::memory_order_relaxed);
+        g_active.store(k, std::memory_order_release);
+    }
+    return *k;
+}
+
+Isa activeIsa()
+{
+    active();
+    return g_activeIsa.load(std::memory_order_relaxed);
+}
+
+bool setIsa(Isa isa)
+{
+    if (!supported(isa))
+        return false;
+
+    g_activeIsa.store(isa, std::memory_order_relaxed);
+    g_active.store(&kernels(isa), std::memory_order_release);
+    return true;
+}
+
+} // namespace PixelKernels
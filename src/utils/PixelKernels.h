@@ -0,0 +1,54 @@
+#pragma once
+#include <QtGlobal>
+#include <QRgb>
+
+// ------------------------------------------------------------
+// PixelKernels – Zeilen-Kernels für den Texturpfad
+// ------------------------------------------------------------
+//  - bgr24ToArgb:  TGA 24-Bit (B,G,R)   → ARGB32, Alpha = 255
+//  - bgra32ToArgb: TGA 32-Bit (B,G,R,A) → ARGB32
+//  - keyMagenta:   (255, 0, 255) bei beliebigem Alpha → 0
+//
+//  Varianten: Scalar, SSE2, SSSE3 (pshufb für 24-Bit), AVX2.
+//  Die beste unterstützte Variante wird beim ersten Aufruf per
+//  CPUID gewählt; setIsa() erzwingt eine andere (Benchmark/Tests).
+//  Alle Varianten liefern bitgleiche Ergebnisse.
+// ------------------------------------------------------------
+namespace PixelKernels {
+
+enum class Isa {
+    Scalar,
+    Sse2,
+    Ssse3,
+    Avx2
+};
+
+struct Kernels {
+    void (*bgr24ToArgb)(const uchar* src, QRgb* dst, int count);
+    void (*bgra32ToArgb)(const uchar* src, QRgb* dst, int count);
+    void (*keyMagenta)(QRgb* line, int count);
+};
+
+// Vom Prozessor (und Build) unterstützt?
+bool supported(Isa isa);
+
+// Beste unterstützte Variante
+Isa bestIsa();
+
+// Aktive Variante (Standard: bestIsa())
+Isa activeIsa();
+bool setIsa(Isa isa);
+
+const char* isaName(Isa isa);
+
+// Kernel-Tabelle einer Variante (nicht unterstützt → Scalar)
+const Kernels& kernels(Isa isa);
+
+// Aktive Kernel-Tabelle
+const Kernels& active();
+
+inline void bgr24ToArgb(const uchar* src, QRgb* dst, int count)  { active().bgr24ToArgb(src, dst, count); }
+inline void bgra32ToArgb(const uchar* src, QRgb* dst, int count) { active().bgra32ToArgb(src, dst, count); }
+inline void keyMagenta(QRgb* line, int count)                    { active().keyMagenta(line, count); }
+
+} // namespace PixelKernels
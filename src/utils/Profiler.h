@@ -0,0 +1,290 @@
+#pragma once
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <QThread>
+#include <QDebug>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+// ------------------------------------------------------------
+// Profiler – Scoped-Timer & Zähler für die Hot-Paths
+// ------------------------------------------------------------
+//  - Standardmäßig aus: ein ScopedTimer kostet dann nur einen
+//    relaxed-Load eines atomic<bool> (kein Clock-Aufruf, kein Lock)
+//  - Mit FLYFF_PROFILING=0 wird alles wegkompiliert
+//  - Export als Chrome-Trace-JSON (chrome://tracing, Perfetto)
+//
+//  Aktivierung: Profiler::setEnabled(true) oder Umgebungsvariable
+//  FLYFF_TRACE=<datei.json> (siehe main.cpp)
+//
+//  Namen/Kategorien müssen String-Literale sein (werden nur als
+//  Zeiger gespeichert).
+// ------------------------------------------------------------
+#ifndef FLYFF_PROFILING
+#define FLYFF_PROFILING 1
+#endif
+
+namespace Profiler {
+
+struct Event {
+    const char* name     = nullptr;
+    const char* category = nullptr;
+    char        phase    = 'X';     // X = Dauer, C = Zähler
+    qint64      startUs  = 0;
+    qint64      durUs    = 0;       // bei C: Zählerwert
+    quintptr    thread   = 0;
+};
+
+namespace detail {
+
+inline std::atomic<bool> g_enabled { false };
+
+struct Buffer {
+    std::mutex         mutex;
+    std::vector<Event> events;
+};
+
+inline Buffer& buffer()
+{
+    static Buffer b;
+    return b;
+}
+
+inline qint64 nowUs()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point origin = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - origin).count();
+}
+
+inline void record(const Event& e)
+{
+    Buffer& b = buffer();
+    std::lock_guard<std::mutex> lock(b.mutex);
+    b.events.push_back(e);
+}
+
+inline quintptr threadId()
+{
+    return reinterpret_cast<quintptr>(QThread::currentThreadId());
+}
+
+inline void appendJsonString(QByteArray& out, const char* s)
+{
+    out += '"';
+    for (; s && *s; ++s) {
+        if (*s == '"' || *s == '\\')
+            out += '\\';
+        out += *s;
+    }
+    out += '"';
+}
+
+} // namespace detail
+
+inline bool enabled()
+{
+#if FLYFF_PROFILING
+    return detail::g_enabled.load(std::memory_order_relaxed);
+#else
+    return false;
+#endif
+}
+
+inline void setEnabled(bool on)
+{
+    detail::nowUs(); // Zeitbasis festlegen
+    detail::g_enabled.store(on, std::memory_order_relaxed);
+}
+
+inline void clear()
+{
+    detail::Buffer& b = detail::buffer();
+    std::lock_guard<std::mutex> lock(b.mutex);
+    b.events.clear();
+}
+
+// Zählerstand (z. B. Anzahl Fenster, Frames)
+inline void counter(const char* name, qint64 value, const char* category = "counter")
+{
+    if (!enabled())
+        return;
+
+    Event e;
+    e.name     = name;
+    e.category = category;
+    e.phase    = 'C';
+    e.startUs  = detail::nowUs();
+    e.durUs    = value;
+    e.thread   = detail::threadId();
+    detail::record(e);
+}
+
+// ------------------------------------------------------------
+// ScopedTimer – misst den umschließenden Block
+// ------------------------------------------------------------
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(const char* name, const char* category = "stage")
+    {
+        if (enabled()) {
+            m_name     = name;
+            m_category = category;
+            m_start    = detail::nowUs();
+        }
+    }
+
+    ~ScopedTimer() { stop(); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    void stop()
+    {
+        if (!m_name)
+            return;
+
+        Event e;
+        e.name     = m_name;
+        e.category = m_category;
+        e.startUs  = m_start;
+        e.durUs    = detail::nowUs() - m_start;
+        e.thread   = detail::threadId();
+        detail::record(e);
+        m_name = nullptr;
+    }
+
+private:
+    const char* m_name     = nullptr;
+    const char* m_category = nullptr;
+    qint64      m_start    = 0;
+};
+
+// ------------------------------------------------------------
+// StageTimer – aufeinanderfolgende Stufen ohne eigene Blöcke
+//   FLYFF_PROFILE_STAGES(t, "load");
+//   FLYFF_PROFILE_NEXT(t, "config"); ... FLYFF_PROFILE_NEXT(t, "theme"); ...
+// ------------------------------------------------------------
+class StageTimer
+{
+public:
+    explicit StageTimer(const char* category)
+        : m_category(category)
+    {}
+
+    ~StageTimer() { finish(); }
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+    void next(const char* stage)
+    {
+        finish();
+        if (enabled()) {
+            m_stage = stage;
+            m_start = detail::nowUs();
+        }
+    }
+
+    void finish()
+    {
+        if (!m_stage)
+            return;
+
+        Event e;
+        e.name     = m_stage;
+        e.category = m_category;
+        e.startUs  = m_start;
+        e.durUs    = detail::nowUs() - m_start;
+        e.thread   = detail::threadId();
+        detail::record(e);
+        m_stage = nullptr;
+    }
+
+private:
+    const char* m_category = nullptr;
+    const char* m_stage    = nullptr;
+    qint64      m_start    = 0;
+};
+
+// ------------------------------------------------------------
+// Chrome-Trace-Export
+// ------------------------------------------------------------
+inline bool writeChromeTrace(const QString& path)
+{
+    std::vector<Event> events;
+    {
+        detail::Buffer& b = detail::buffer();
+        std::lock_guard<std::mutex> lock(b.mutex);
+        events = b.events;
+    }
+
+    QByteArray out;
+    out.reserve(qsizetype(events.size()) * 96 + 32);
+    out += "{\"traceEvents\":[\n";
+
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const Event& e = events[i];
+        if (i > 0)
+            out += ",\n";
+
+        out += "{\"name\":";
+        detail::appendJsonString(out, e.name);
+        out += ",\"cat\":";
+        detail::appendJsonString(out, e.category);
+        out += ",\"ph\":\"";
+        out += e.phase;
+        out += "\",\"pid\":1,\"tid\":";
+        out += QByteArray::number(quint64(e.thread));
+        out += ",\"ts\":";
+        out += QByteArray::number(e.startUs);
+
+        if (e.phase == 'C') {
+            out += ",\"args\":{\"value\":";
+            out += QByteArray::number(e.durUs);
+            out += "}}";
+        } else {
+            out += ",\"dur\":";
+            out += QByteArray::number(e.durUs);
+            out += '}';
+        }
+    }
+
+    out += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(out) != out.size()) {
+        qWarning() << "[Profiler] Trace konnte nicht geschrieben werden:" << path;
+        return false;
+    }
+
+    qInfo() << "[Profiler] Trace gespeichert:" << path << "(" << events.size() << "Events )";
+    return true;
+}
+
+} // namespace Profiler
+
+// ------------------------------------------------------------
+// Makros (verschwinden bei FLYFF_PROFILING=0)
+// ------------------------------------------------------------
+#if FLYFF_PROFILING
+#define FLYFF_PROFILE_CONCAT_(a, b) a##b
+#define FLYFF_PROFILE_CONCAT(a, b)  FLYFF_PROFILE_CONCAT_(a, b)
+#define FLYFF_PROFILE_SCOPE(name, category) \
+    Profiler::ScopedTimer FLYFF_PROFILE_CONCAT(flyffProfileScope_, __LINE__)(name, category)
+#define FLYFF_PROFILE_COUNTER(name, value) Profiler::counter(name, value)
+#define FLYFF_PROFILE_STAGES(var, category) Profiler::StageTimer var(category)
+#define FLYFF_PROFILE_NEXT(var, stage)      (var).next(stage)
+#define FLYFF_PROFILE_FINISH(var)           (var).finish()
+#else
+#define FLYFF_PROFILE_SCOPE(name, category) do {} while (0)
+#define FLYFF_PROFILE_COUNTER(name, value)  do {} while (0)
+#define FLYFF_PROFILE_STAGES(var, category) do {} while (0)
+#define FLYFF_PROFILE_NEXT(var, stage)      do {} while (0)
+#define FLYFF_PROFILE_FINISH(var)           do {} while (0)
+#endif
@@ -9,121 +9,443 @@
 #include <QTextStream>
 #include <QDir>
 #include <QIcon>
+#include <QVarLengthArray>
+
+#include <algorithm>
+
+#include "PixelKernels.h"
+#include "TextureCache.h"
 
 namespace ResourceUtils
 {
 
 // ------------------------------------------------------------
-// 🔹 FlyFF-kompatibler TGA-Loader (unkomprimiert, 24/32-Bit)
+// 🔹 Pixel-Kernels (arbeiten direkt auf ARGB32-Scanlines)
 // ------------------------------------------------------------
-inline QImage loadFlyffTga(const QString& path)
+namespace detail
 {
-    QFile file(path);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qWarning() << "[ResourceUtils] Konnte TGA-Datei nicht öffnen:" << path;
-        return QImage();
+
+// transparent setzen (SIMD, siehe PixelKernels)
+inline void keyMagentaRow(QRgb* line, int count)
+{
+    if (count > 0)
+        PixelKernels::keyMagenta(line, count);
+}
+
+// Nicht deckende Randpixel vom inneren Nachbarn übernehmen.
+// Reihenfolge wie bisher: erst links/rechts je Zeile, dann oben/unten
+// je Spalte (Ecken sehen damit die bereits geklemmten Seitenwerte).
+inline void clampEdgesInPlace(QImage& img)
+{
+    const int w = img.width();
+    const int h = img.height();
+    if (w <= 0 || h <= 0)
+        return;
+
+    if (w > 1) {
+        for (int y = 0; y < h; ++y) {
+            QRgb* line = reinterpret_cast<QRgb*>(img.scanLine(y));
+            if (qAlpha(line[0]) < 255)
+                line[0] = line[1];
+            if (qAlpha(line[w - 1]) < 255)
+                line[w - 1] = line[w - 2];
+        }
     }
 
-    QByteArray data = file.readAll();
-    if (data.size() < 18)
-        return QImage();
+    if (h > 1) {
+        QRgb* top    = reinterpret_cast<QRgb*>(img.scanLine(0));
+        QRgb* below  = reinterpret_cast<QRgb*>(img.scanLine(1));
+        QRgb* bottom = reinterpret_cast<QRgb*>(img.scanLine(h - 1));
+        QRgb* above  = reinterpret_cast<QRgb*>(img.scanLine(h - 2));
 
-    const unsigned char* d = reinterpret_cast<const unsigned char*>(data.constData());
-    int width  = d[12] + (d[13] << 8);
-    int height = d[14] + (d[15] << 8);
-    int bpp    = d[16];
+        for (int x = 0; x < w; ++x) {
+            if (qAlpha(top[x]) < 255)
+                top[x] = below[x];
+            if (qAlpha(bottom[x]) < 255)
+                bottom[x] = above[x];
+        }
+    }
+}
 
-    if (width <= 0 || height <= 0 || (bpp != 24 && bpp != 32))
+// Rand (erste/letzte Zeile + Spalte) nachträglich keyen
+inline void keyMagentaBorder(QImage& img)
+{
+    const int w = img.width();
+    const int h = img.height();
+    if (w <= 0 || h <= 0)
+        return;
+
+    keyMagentaRow(reinterpret_cast<QRgb*>(img.scanLine(0)), w);
+    if (h > 1)
+        keyMagentaRow(reinterpret_cast<QRgb*>(img.scanLine(h - 1)), w);
+
+    for (int y = 1; y < h - 1; ++y) {
+        QRgb* line = reinterpret_cast<QRgb*>(img.scanLine(y));
+        keyMagentaRow(line, 1);
+        if (w > 1)
+            keyMagentaRow(line + w - 1, 1);
+    }
+}
+
+// ------------------------------------------------------------
+// TGA-Decoder
+// ------------------------------------------------------------
+//  Bildtypen: 1/9 Palette, 2/10 Truecolor, 3/11 Graustufen
+//  (9–11 = RLE). Pixeltiefen: 8 (Index/Grau), 15/16 (5551 bzw.
+//  Index16/Grau+Alpha), 24, 32. ID-Feld und Palette werden über die
+//  Headerlängen übersprungen, Ursprung (Bit 4/5 des Deskriptors)
+//  wird beachtet. Es wird direkt in das Ziel-QImage dekodiert – das
+//  ist die einzige Allokation (Paletten bis 256 Einträge liegen auf
+//  dem Stack, die Datei wird gemappt).
+//
+//  themeFixups = true → Magenta wird zeilenweise beim Dekodieren
+//  gekeyt, danach nur noch der Rand (Clamp + Key, O(w+h)). Ergebnis
+//  identisch zu applyMagentaMask(clampTransparentEdges(...)):
+//  Randpixel bleiben bis nach dem Clamp ungekeyt, weil der Clamp am
+//  Original-Alpha entscheidet; Keyen ist idempotent, daher dürfen
+//  bereits gekeyte Innenpixel als Clamp-Quelle dienen.
+// ------------------------------------------------------------
+enum class TgaPixel {
+    Bgr24,
+    Bgra32,
+    Argb1555,
+    Gray8,
+    GrayAlpha16,
+    Index8,
+    Index16
+};
+
+inline QRgb tga1555(const uchar* p, bool useAlpha)
+{
+    const uint v = uint(p[0]) | (uint(p[1]) << 8);
+    const uint r = (v >> 10) & 0x1F;
+    const uint g = (v >> 5)  & 0x1F;
+    const uint b =  v        & 0x1F;
+    const uint a = (!useAlpha || (v & 0x8000)) ? 255 : 0;
+    return qRgba(int((r << 3) | (r >> 2)), int((g << 3) | (g >> 2)), int((b << 3) | (b >> 2)), int(a));
+}
+
+inline QImage decodeTga(const uchar* d, qint64 size, bool themeFixups, const QString& path)
+{
+    if (size < 18)
         return QImage();
 
-    int bytesPerPixel = bpp / 8;
-    int imageSize = width * height * bytesPerPixel;
+    const int idLength     = d[0];
+    const int colorMapType = d[1];
+    const int imageType    = d[2];
+    const int cmFirst      = d[3] | (d[4] << 8);
+    const int cmLength     = d[5] | (d[6] << 8);
+    const int cmDepth      = d[7];
+    const int width        = d[12] + (d[13] << 8);
+    const int height       = d[14] + (d[15] << 8);
+    const int bpp          = d[16];
+    const int descriptor   = d[17];
+
+    const bool rle         = imageType >= 9 && imageType <= 11;
+    const int  baseType    = rle ? imageType - 8 : imageType;
+    const bool topDown     = (descriptor & 0x20) != 0;
+    const bool rightToLeft = (descriptor & 0x10) != 0;
+    const bool alphaBits   = (descriptor & 0x0F) != 0;
+
+    if (width <= 0 || height <= 0)
+        return QImage();
 
-    if (data.size() < 18 + imageSize) {
-        qWarning() << "[ResourceUtils] TGA-Datei unvollständig:" << path;
+    // ---- Pixelformat bestimmen ----
+    TgaPixel fmt;
+    if (baseType == 2 && bpp == 24)                         fmt = TgaPixel::Bgr24;
+    else if (baseType == 2 && bpp == 32)                    fmt = TgaPixel::Bgra32;
+    else if (baseType == 2 && (bpp == 15 || bpp == 16))     fmt = TgaPixel::Argb1555;
+    else if (baseType == 3 && bpp == 8)                     fmt = TgaPixel::Gray8;
+    else if (baseType == 3 && bpp == 16)                    fmt = TgaPixel::GrayAlpha16;
+    else if (baseType == 1 && colorMapType == 1 && bpp == 8)  fmt = TgaPixel::Index8;
+    else if (baseType == 1 && colorMapType == 1 && bpp == 16) fmt = TgaPixel::Index16;
+    else {
+        qWarning() << "[ResourceUtils] TGA-Format nicht unterstützt:" << path
+                   << "(Typ" << imageType << "," << bpp << "Bit)";
         return QImage();
     }
 
+    const int bytesPerPixel = (bpp + 7) / 8;
+    qint64 pos = 18 + idLength;
+
+    // ---- Palette (wird auch bei Truecolor übersprungen) ----
+    QVarLengthArray<QRgb, 256> palette;
+    if (colorMapType == 1)
+    {
+        const int entryBytes = (cmDepth + 7) / 8;
+        const qint64 paletteBytes = qint64(cmLength) * entryBytes;
+
+        if (pos + paletteBytes > size) {
+            qWarning() << "[ResourceUtils] TGA-Datei unvollständig:" << path;
+            return QImage();
+        }
+
+        if (baseType == 1)
+        {
+            if (cmDepth != 15 && cmDepth != 16 && cmDepth != 24 && cmDepth != 32) {
+                qWarning() << "[ResourceUtils] TGA-Palettenformat nicht unterstützt:" << path;
+                return QImage();
+            }
+
+            palette.resize(cmLength);
+            const uchar* e = d + pos;
+            for (int i = 0; i < cmLength; ++i, e += entryBytes) {
+                if (entryBytes == 2)      palette[i] = tga1555(e, alphaBits);
+                else if (entryBytes == 3) palette[i] = qRgb(e[2], e[1], e[0]);
+                else                      palette[i] = qRgba(e[2], e[1], e[0], e[3]);
+            }
+        }
+
+        pos += paletteBytes;
+    }
+
+    const PixelKernels::Kernels& kernels = PixelKernels::active();
+
+    auto lookup = [&](int index) -> QRgb {
+        const int i = index - cmFirst;
+        return (i >= 0 && i < palette.size()) ? palette[i] : 0u;
+    };
+
+    // n Pixel Quellformat → ARGB32
+    auto convert = [&](const uchar* src, QRgb* dst, int n) {
+        switch (fmt) {
+        case TgaPixel::Bgr24:
+            kernels.bgr24ToArgb(src, dst, n);
+            break;
+        case TgaPixel::Bgra32:
+            kernels.bgra32ToArgb(src, dst, n);
+            break;
+        case TgaPixel::Argb1555:
+            for (int x = 0; x < n; ++x, src += 2)
+                dst[x] = tga1555(src, alphaBits);
+            break;
+        case TgaPixel::Gray8:
+            for (int x = 0; x < n; ++x)
+                dst[x] = qRgb(src[x], src[x], src[x]);
+            break;
+        case TgaPixel::GrayAlpha16:
+            for (int x = 0; x < n; ++x, src += 2)
+                dst[x] = qRgba(src[0], src[0], src[0], src[1]);
+            break;
+        case TgaPixel::Index8:
+            for (int x = 0; x < n; ++x)
+                dst[x] = lookup(src[x]);
+            break;
+        case TgaPixel::Index16:
+            for (int x = 0; x < n; ++x, src += 2)
+                dst[x] = lookup(src[0] | (src[1] << 8));
+            break;
+        }
+    };
+
     QImage img(width, height, QImage::Format_ARGB32);
-    const unsigned char* src = d + 18;
-
-    // Vertikal flippen, Farbreihenfolge korrigieren (BGR → RGB)
-    for (int y = 0; y < height; ++y) {
-        QRgb* dest = reinterpret_cast<QRgb*>(img.scanLine(height - 1 - y));
-        for (int x = 0; x < width; ++x) {
-            uchar b = *src++;
-            uchar g = *src++;
-            uchar r = *src++;
-            uchar a = (bytesPerPixel == 4) ? *src++ : 255;
-            dest[x] = qRgba(r, g, b, a);
+    if (img.isNull())
+        return img;
+
+    // Dateizeile → Zielzeile (Standard: bottom-up → vertikal flippen)
+    auto destRow = [&](int fileRow) {
+        const int destY = topDown ? fileRow : height - 1 - fileRow;
+        return reinterpret_cast<QRgb*>(img.scanLine(destY));
+    };
+
+    auto finishRow = [&](int fileRow, QRgb* row) {
+        if (rightToLeft)
+            std::reverse(row, row + width);
+
+        // Innenpixel sofort keyen; Randzeilen/-spalten erst nach dem Clamp
+        const int destY = topDown ? fileRow : height - 1 - fileRow;
+        if (themeFixups && destY != 0 && destY != height - 1 && width > 2)
+            kernels.keyMagenta(row + 1, width - 2);
+    };
+
+    const uchar* src = d + pos;
+    const uchar* end = d + size;
+    const qint64 rowBytes = qint64(width) * bytesPerPixel;
+
+    if (!rle)
+    {
+        if (end - src < rowBytes * height) {
+            qWarning() << "[ResourceUtils] TGA-Datei unvollständig:" << path;
+            return QImage();
+        }
+
+        for (int y = 0; y < height; ++y, src += rowBytes) {
+            QRgb* row = destRow(y);
+            convert(src, row, width);
+            finishRow(y, row);
+        }
+    }
+    else
+    {
+        // Pakete dürfen über Zeilengrenzen laufen
+        int fileRow = 0;
+        int x = 0;
+        QRgb* row = destRow(0);
+
+        while (fileRow < height)
+        {
+            if (src >= end) {
+                qWarning() << "[ResourceUtils] TGA-RLE-Daten unvollständig:" << path;
+                return QImage();
+            }
+
+            const uchar packet = *src++;
+            int count = (packet & 0x7F) + 1;
+            const bool run = (packet & 0x80) != 0;
+
+            const qint64 need = run ? bytesPerPixel : qint64(count) * bytesPerPixel;
+            if (end - src < need) {
+                qWarning() << "[ResourceUtils] TGA-RLE-Daten unvollständig:" << path;
+                return QImage();
+            }
+
+            QRgb runValue = 0;
+            if (run) {
+                convert(src, &runValue, 1);
+                src += bytesPerPixel;
+            }
+
+            while (count > 0 && fileRow < height)
+            {
+                const int n = qMin(count, width - x);
+
+                if (run) {
+                    std::fill(row + x, row + x + n, runValue);
+                } else {
+                    convert(src, row + x, n);
+                    src += qint64(n) * bytesPerPixel;
+                }
+
+                x += n;
+                count -= n;
+
+                if (x == width) {
+                    finishRow(fileRow, row);
+                    x = 0;
+                    if (++fileRow < height)
+                        row = destRow(fileRow);
+                }
+            }
         }
     }
 
+    if (themeFixups) {
+        clampEdgesInPlace(img);
+        keyMagentaBorder(img);
+    }
+
     return img;
 }
 
+inline QImage loadTga(const QString& path, bool themeFixups)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "[ResourceUtils] Konnte TGA-Datei nicht öffnen:" << path;
+        return QImage();
+    }
+
+    // Datei direkt mappen (keine Kopie), sonst einlesen
+    const qint64 size = file.size();
+    if (const uchar* mapped = file.map(0, size))
+        return decodeTga(mapped, size, themeFixups, path);
+
+    const QByteArray data = file.readAll();
+    return decodeTga(reinterpret_cast<const uchar*>(data.constData()),
+                     data.size(), themeFixups, path);
+}
+
+} // namespace detail
+
+// ------------------------------------------------------------
+// 🔹 FlyFF-kompatibler TGA-Loader (RLE, Palette, 8/16/24/32-Bit)
+// ------------------------------------------------------------
+inline QImage loadFlyffTga(const QString& path)
+{
+    return detail::loadTga(path, false);
+}
+
 // ------------------------------------------------------------
 // 🔹 Entfernt FlyFF-typische Magenta-Maskenfarbe (255, 0, 255)
 // ------------------------------------------------------------
-inline QPixmap applyMagentaMask(const QPixmap& src)
+inline QImage applyMagentaMask(const QImage& src)
 {
     if (src.isNull())
         return src;
 
-    QImage img = src.toImage().convertToFormat(QImage::Format_ARGB32);
+    QImage img = src.convertToFormat(QImage::Format_ARGB32);
 
     const int w = img.width();
     const int h = img.height();
 
-    for (int y = 0; y < h; ++y) {
-        QRgb* line = reinterpret_cast<QRgb*>(img.scanLine(y));
-        for (int x = 0; x < w; ++x) {
-            QRgb px = line[x];
-            if (qRed(px) == 255 && qGreen(px) == 0 && qBlue(px) == 255) {
-                line[x] = qRgba(0, 0, 0, 0); // transparent setzen
-            }
-        }
-    }
+    for (int y = 0; y < h; ++y)
+        detail::keyMagentaRow(reinterpret_cast<QRgb*>(img.scanLine(y)), w);
+
+    return img;
+}
+
+inline QPixmap applyMagentaMask(const QPixmap& src)
+{
+    if (src.isNull())
+        return src;
 
-    return QPixmap::fromImage(img);
+    return QPixmap::fromImage(applyMagentaMask(src.toImage()));
 }
 
 // ------------------------------------------------------------
 // 🔹 Entfernt transparente Ränder / clamped sie an benachbarte Pixel
 // ------------------------------------------------------------
+inline QImage clampTransparentEdges(const QImage& src)
+{
+    if (src.isNull() || !src.hasAlphaChannel())
+        return src;
+
+    QImage img = src.convertToFormat(QImage::Format_ARGB32);
+    detail::clampEdgesInPlace(img);
+    return img;
+}
+
 inline QPixmap clampTransparentEdges(const QPixmap& src)
 {
     if (src.isNull() || !src.hasAlphaChannel())
         return src;
 
-    QImage img = src.toImage().convertToFormat(QImage::Format_ARGB32);
-    const int w = img.width();
-    const int h = img.height();
+    return QPixmap::fromImage(clampTransparentEdges(src.toImage()));
+}
 
-    auto getSafe = [&](int x, int y) -> QRgb {
-        x = std::clamp(x, 0, w - 1);
-        y = std::clamp(y, 0, h - 1);
-        return img.pixel(x, y);
-    };
+// ------------------------------------------------------------
+// 🔹 Theme-Textur laden: TGA fusioniert (ein Durchgang),
+//    andere Formate über QImageReader + Clamp + Magenta
+// ------------------------------------------------------------
+inline QImage loadThemeImage(const QString& filePath)
+{
+    if (filePath.endsWith(QLatin1String(".tga"), Qt::CaseInsensitive))
+        return detail::loadTga(filePath, true);
 
-    // Linker / rechter Rand
-    for (int y = 0; y < h; ++y) {
-        QRgb* line = reinterpret_cast<QRgb*>(img.scanLine(y));
-        if (qAlpha(line[0]) < 255 && w > 1)
-            line[0] = getSafe(1, y);
-        if (qAlpha(line[w - 1]) < 255 && w > 1)
-            line[w - 1] = getSafe(w - 2, y);
-    }
+    QImageReader reader(filePath);
+    reader.setAutoTransform(true);
+    QImage img = reader.read();
+    if (img.isNull())
+        return img;
 
-    // Oberer / unterer Rand
-    for (int x = 0; x < w; ++x) {
-        if (qAlpha(img.pixel(x, 0)) < 255 && h > 1)
-            img.setPixel(x, 0, getSafe(x, 1));
-        if (qAlpha(img.pixel(x, h - 1)) < 255 && h > 1)
-            img.setPixel(x, h - 1, getSafe(x, h - 2));
-    }
+    img = clampTransparentEdges(img);
+    return applyMagentaMask(img);
+}
+
+// ------------------------------------------------------------
+// 🔹 Helper: Lädt ein einzelnes Bild (mit TGA-Fallback)
+//    Nur QImage → auch aus Worker-Threads nutzbar
+// ------------------------------------------------------------
+inline QImage loadSingleImage(const QString& filePath)
+{
+    QFileInfo fi(filePath);
+
+    if (fi.suffix().compare("tga", Qt::CaseInsensitive) == 0)
+        return loadFlyffTga(filePath);
 
-    return QPixmap::fromImage(img);
+    QImageReader reader(filePath);
+    reader.setAutoTransform(true);
+    return reader.read();
 }
 
 // ------------------------------------------------------------
@@ -131,20 +453,8 @@ inline QPixmap clampTransparentEdges(const QPixmap& src)
 // ------------------------------------------------------------
 inline QPixmap loadSinglePixmap(const QString& filePath)
 {
-    QFileInfo fi(filePath);
-    QPixmap pix;
-
-    if (fi.suffix().compare("tga", Qt::CaseInsensitive) == 0) {
-        QImage tga = loadFlyffTga(filePath);
-        if (!tga.isNull())
-            pix = QPixmap::fromImage(tga);
-    } else {
-        QImageReader reader(filePath);
-        reader.setAutoTransform(true);
-        pix = QPixmap::fromImageReader(&reader);
-    }
-
-    return pix;
+    const QImage img = loadSingleImage(filePath);
+    return img.isNull() ? QPixmap() : QPixmap::fromImage(img);
 }
 
 inline QPixmap stripFlyffGhostBorder(const QPixmap& src)
@@ -185,10 +495,13 @@ inline QPixmap stripFlyffGhostBorder(const QPixmap& src)
 
 // ------------------------------------------------------------
 // 🔹 Lädt Icons (kleinere Grafiken, Buttons etc.)
+//    loadIconImages dekodiert nur (Worker-Thread), iconsFromImages
+//    erzeugt die QIcons (GUI-Thread). Unveränderte Dateien kommen
+//    aus dem TextureCache des Icon-Ordners.
 // ------------------------------------------------------------
-inline QMap<QString, QIcon> loadIcons(const QString& dirPath)
+inline QMap<QString, QImage> loadIconImages(const QString& dirPath)
 {
-    QMap<QString, QIcon> result;
+    QMap<QString, QImage> result;
 
     if (dirPath.isEmpty() || !QDir(dirPath).exists()) {
         qWarning() << "[ResourceUtils] Icon-Pfad ungültig:" << dirPath;
@@ -202,37 +515,49 @@ inline QMap<QString, QIcon> loadIcons(const QString& dirPath)
     logFile.open(QIODevice::WriteOnly | QIODevice::Text);
     QTextStream log(&logFile);
 
+    TextureCache cache(dirPath, "icons");
+
     int loaded = 0;
     int failed = 0;
 
     while (it.hasNext()) {
         const QString filePath = it.next();
-        QFileInfo fi(filePath);
+        const QFileInfo fi = it.fileInfo();
         const QString key = fi.baseName().toLower();
 
-        // reuse: dein bestehender Loader
-        QPixmap pix = loadSinglePixmap(filePath);
+        TextureCache::Texture tex;
+        const bool cached = cache.lookup(fi, tex);
+
+        if (cached) {
+            cache.keep(fi);
+        } else {
+            const QImage img = loadSingleImage(filePath);
 
-        if (pix.isNull()) {
-            log << "❌ Fehler: " << filePath << "\n";
-            failed++;
-            continue;
+            if (img.isNull()) {
+                log << "❌ Fehler: " << filePath << "\n";
+                failed++;
+                continue;
+            }
+
+            tex.image = img.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+            cache.insert(fi, tex);
         }
 
-        QIcon icon;
-        icon.addPixmap(pix);                // falls du später mehrere Größen hinzufügen willst
-        result.insert(key, icon);
+        log << "✅ Geladen: " << key
+            << " (" << tex.image.width() << "x" << tex.image.height() << ")"
+            << (cached ? " (Cache)" : "") << "\n";
+        result.insert(key, std::move(tex.image));
 
         loaded++;
-        log << "✅ Geladen: " << key
-            << " (" << pix.width() << "x" << pix.height() << ")\n";
     }
 
     log << "\nGesamt geladen: " << loaded
         << " | Fehler: " << failed
-        << " | Gesamtdateien: " << (loaded + failed) << "\n";
+        << " | Gesamtdateien: " << (loaded + failed)
+        << " | Cache: " << cache.hits() << "\n";
 
     logFile.close();
+    cache.save();
 
     qInfo().noquote() << QString("[ResourceUtils] Icons geladen: %1 Dateien (%2 Fehler)")
                              .arg(loaded)
@@ -242,6 +567,24 @@ inline QMap<QString, QIcon> loadIcons(const QString& dirPath)
     return result;
 }
 
+inline QMap<QString, QIcon> iconsFromImages(const QMap<QString, QImage>& images)
+{
+    QMap<QString, QIcon> result;
+
+    for (auto it = images.cbegin(); it != images.cend(); ++it) {
+        QIcon icon;
+        icon.addPixmap(QPixmap::fromImage(it.value()));   // falls du später mehrere Größen hinzufügen willst
+        result.insert(it.key(), icon);
+    }
+
+    return result;
+}
+
+inline QMap<QString, QIcon> loadIcons(const QString& dirPath)
+{
+    return iconsFromImages(loadIconImages(dirPath));
+}
+
 // DetectTilePrefix – erkennt dynamisch Fenster- und Control-Tiles
 // inline QString detectTilePrefix(const QMap<QString, QPixmap>& themes,
 //                                 const QStringList& candidates = {},
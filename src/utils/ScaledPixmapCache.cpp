@@ -0,0 +1,33 @@
+#include "utils/ScaledPixmapCache.h"
+
+ScaledPixmapCache::ScaledPixmapCache(qint64 budgetBytes)
+{
+    setBudget(budgetBytes);
+}
+
+void ScaledPixmapCache::setBudget(qint64 bytes)
+{
+    m_budget = qMax<qint64>(0, bytes);
+    m_cache.setMaxCost(PixmapCost::budget(m_budget));
+}
+
+QPixmap ScaledPixmapCache::scaled(const Key& key, const TextureRegion& source)
+{
+    if (source.isNull() || key.size.isEmpty())
+        return QPixmap();
+
+    if (const QPixmap* hit = m_cache.object(key)) {
+        ++m_hits;
+        return *hit;
+    }
+
+    ++m_misses;
+
+    // Erst aus dem Atlas lösen, damit kein Nachbar mitgesampelt wird
+    QPixmap result = source.page.copy(source.rect);
+    if (result.size() != key.size)
+        result = result.scaled(key.size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+    m_cache.insert(key, new QPixmap(result), PixmapCost::kib(result));
+    return result;
+}
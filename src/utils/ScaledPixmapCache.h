@@ -0,0 +1,83 @@
+#pragma once
+#include <QCache>
+#include <QHashFunctions>
+#include <QPixmap>
+#include <QSize>
+
+#include <limits>
+
+#include "TextureAtlas.h"
+
+// ------------------------------------------------------------
+// Pixmap-Caches (QCache) rechnen in KiB, damit Budgets über 2 GiB
+// Bytes noch in int passen. QCache verwirft beim insert() Einträge
+// über Budget selbst (auch den neuen); der Aufrufer behält daher
+// immer eine eigene Kopie des eingefügten Bildes.
+// ------------------------------------------------------------
+namespace PixmapCost
+{
+// Kosten eines Bildes in KiB (mindestens 1)
+inline int kib(const QPixmap& pm)
+{
+    const qint64 bytes = qint64(pm.width()) * pm.height() * (pm.depth() / 8);
+    return int(qMax<qint64>(1, bytes / 1024));
+}
+
+// Budget in Bytes → maxCost in KiB (auf int begrenzt)
+inline int budget(qint64 bytes)
+{
+    const qint64 kib = qMax<qint64>(0, bytes) / 1024;
+    return int(qMin<qint64>(kib, std::numeric_limits<int>::max()));
+}
+} // namespace PixmapCost
+
+// ------------------------------------------------------------
+// ScaledPixmapCache – LRU-Cache für auf Zielgröße skalierte Texturen
+// ------------------------------------------------------------
+//  - Schlüssel: (Textur-Handle, State-Index, Zielgröße)
+//  - Skaliert wird einmal mit Qt::SmoothTransformation aus dem
+//    Atlas-Teilrechteck; danach ist jeder Repaint ein reiner Blit
+//  - Speicherbudget in Bytes; bei Überschreitung fliegen die am
+//    längsten nicht benutzten Einträge raus (QCache)
+//  - Nur GUI-Thread (QPixmap)
+// ------------------------------------------------------------
+class ScaledPixmapCache
+{
+public:
+    struct Key {
+        int   texture = -1;
+        int   state   = 0;
+        QSize size;
+
+        bool operator==(const Key& o) const
+        {
+            return texture == o.texture && state == o.state && size == o.size;
+        }
+    };
+
+    static constexpr qint64 kDefaultBudget = 32 * 1024 * 1024;
+
+    explicit ScaledPixmapCache(qint64 budgetBytes = kDefaultBudget);
+
+    void   setBudget(qint64 bytes);
+    qint64 budget() const { return m_budget; }
+
+    // Liefert die skalierte Textur (bei Bedarf erzeugt und gecacht)
+    QPixmap scaled(const Key& key, const TextureRegion& source);
+
+    void clear() { m_cache.clear(); }
+
+    int hits() const   { return m_hits; }
+    int misses() const { return m_misses; }
+
+private:
+    QCache<Key, QPixmap> m_cache;
+    qint64 m_budget = kDefaultBudget;
+    int    m_hits   = 0;
+    int    m_misses = 0;
+};
+
+inline size_t qHash(const ScaledPixmapCache::Key& key, size_t seed = 0)
+{
+    return qHashMulti(seed, key.texture, key.state, key.size.width(), key.size.height());
+}
@@ -0,0 +1,145 @@
+#include "utils/TextureAtlas.h"
+
+#include <QSize>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+int TextureAtlas::add(const QImage& image, const QRect& source)
+{
+    Item item;
+    item.image  = image.format() == QImage::Format_ARGB32_Premultiplied
+                      ? image
+                      : image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    item.source = source & item.image.rect();
+
+    m_items.append(item);
+    return int(m_items.size()) - 1;
+}
+
+TextureAtlas::Placement TextureAtlas::placement(int index) const
+{
+    if (index < 0 || index >= m_items.size())
+        return {};
+    return m_items[index].placement;
+}
+
+// ------------------------------------------------------------
+// Packen: erst Platzierung (Seitengrößen), dann Pixel kopieren
+// ------------------------------------------------------------
+void TextureAtlas::build()
+{
+    m_pages.clear();
+
+    // Größte Höhe zuerst → wenig Verschnitt pro Regal
+    std::vector<int> order(size_t(m_items.size()));
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](int a, int b) {
+        const QRect& ra = m_items[a].source;
+        const QRect& rb = m_items[b].source;
+        if (ra.height() != rb.height())
+            return ra.height() > rb.height();
+        return ra.width() > rb.width();
+    });
+
+    QList<QSize> pageSizes;
+    int shelfPage = -1;
+    int shelfX = 0, shelfY = 0, shelfH = 0;
+
+    for (int index : order)
+    {
+        Item& item = m_items[index];
+        const QSize s = item.source.size();
+
+        if (s.isEmpty())
+            continue;
+
+        // Große Texturen → eigene Seite, kein Rand nötig
+        if (s.width() > kMaxPacked || s.height() > kMaxPacked) {
+            item.placement.page = int(pageSizes.size());
+            item.placement.rect = QRect(QPoint(0, 0), s);
+            pageSizes.append(s);
+            continue;
+        }
+
+        const int w = s.width()  + 2 * kGutter;
+        const int h = s.height() + 2 * kGutter;
+
+        if (shelfPage >= 0 && shelfX + w > kPageSize) {
+            shelfY += shelfH;
+            shelfX = 0;
+            shelfH = 0;
+        }
+
+        if (shelfPage < 0 || shelfY + h > kPageSize) {
+            shelfPage = int(pageSizes.size());
+            pageSizes.append(QSize(kPageSize, 0));
+            shelfX = shelfY = shelfH = 0;
+        }
+
+        item.placement.page = shelfPage;
+        item.placement.rect = QRect(shelfX + kGutter, shelfY + kGutter, s.width(), s.height());
+
+        shelfX += w;
+        shelfH  = qMax(shelfH, h);
+
+        // Seitenhöhe auf den belegten Bereich begrenzen
+        QSize& page = pageSizes[shelfPage];
+        page.setHeight(qMax(page.height(), shelfY + shelfH));
+    }
+
+    m_pages.reserve(pageSizes.size());
+    for (const QSize& size : pageSizes) {
+        QImage page(size, QImage::Format_ARGB32_Premultiplied);
+        page.fill(Qt::transparent);
+        m_pages.append(page);
+    }
+
+    for (const Item& item : std::as_const(m_items)) {
+        if (item.placement.page < 0)
+            continue;
+
+        QImage& page = m_pages[item.placement.page];
+        const bool own = page.size() == item.placement.rect.size();
+        blit(page, item, own ? 0 : kGutter);
+    }
+}
+
+// ------------------------------------------------------------
+// Kopieren + Rand mit Kantenpixeln auffüllen
+// ------------------------------------------------------------
+void TextureAtlas::blit(QImage& page, const Item& item, int gutter)
+{
+    const QRect& src = item.source;
+    const QRect& dst = item.placement.rect;
+    const size_t rowBytes = size_t(src.width()) * 4;
+
+    for (int y = 0; y < src.height(); ++y)
+    {
+        const QRgb* in = reinterpret_cast<const QRgb*>(item.image.constScanLine(src.y() + y)) + src.x();
+        QRgb* out = reinterpret_cast<QRgb*>(page.scanLine(dst.y() + y)) + dst.x();
+
+        std::memcpy(out, in, rowBytes);
+
+        for (int g = 1; g <= gutter; ++g) {
+            out[-g] = in[0];
+            out[src.width() - 1 + g] = in[src.width() - 1];
+        }
+    }
+
+    // Ober-/Unterkante inkl. der bereits gefüllten Seitenränder
+    const size_t paddedBytes = size_t(src.width() + 2 * gutter) * 4;
+    const int x0 = dst.x() - gutter;
+
+    for (int g = 1; g <= gutter; ++g) {
+        std::memcpy(reinterpret_cast<QRgb*>(page.scanLine(dst.y() - g)) + x0,
+                    reinterpret_cast<const QRgb*>(page.constScanLine(dst.y())) + x0,
+                    paddedBytes);
+        std::memcpy(reinterpret_cast<QRgb*>(page.scanLine(dst.bottom() + g)) + x0,
+                    reinterpret_cast<const QRgb*>(page.constScanLine(dst.bottom())) + x0,
+                    paddedBytes);
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <QImage>
+#include <QPixmap>
+#include <QRect>
+#include <QList>
+
+// ------------------------------------------------------------
+// TextureRegion – Handle auf einen Teilbereich einer Atlas-Seite
+// ------------------------------------------------------------
+//  Leichtgewichtig (QPixmap ist implizit geteilt): Kopien kosten
+//  nur einen Referenzzähler, es wird nichts allokiert.
+//  Gezeichnet wird immer mit Quellrechteck:
+//    p.drawPixmap(target, region.page, region.rect);
+// ------------------------------------------------------------
+struct TextureRegion
+{
+    QPixmap page;
+    QRect   rect;
+
+    bool  isNull() const { return page.isNull() || rect.isEmpty(); }
+    int   width() const  { return rect.width(); }
+    int   height() const { return rect.height(); }
+    QSize size() const   { return rect.size(); }
+};
+
+// ------------------------------------------------------------
+// TextureAtlas – packt viele kleine Texturen in wenige Seiten
+// ------------------------------------------------------------
+//  - Shelf-Packing (nach Höhe sortiert) in Seiten zu kPageSize²
+//  - Jede Textur bekommt einen Rand von kGutter Pixeln mit
+//    wiederholten Kantenpixeln → kein Ausbluten beim Skalieren
+//  - Texturen größer als kMaxPacked (z. B. Fensterhintergründe)
+//    landen auf einer eigenen, passgenauen Seite
+//  - Arbeitet nur mit QImage (ARGB32_Premultiplied) und ist damit
+//    im Worker-Thread nutzbar; QPixmaps erst beim Übernehmen
+//
+//  Ablauf:
+//    TextureAtlas atlas;
+//    int id = atlas.add(image, sourceRect);   // keine Kopie
+//    atlas.build();
+//    atlas.pages()[atlas.placement(id).page] ...
+// ------------------------------------------------------------
+class TextureAtlas
+{
+public:
+    static constexpr int kPageSize  = 1024;
+    static constexpr int kMaxPacked = 256;
+    static constexpr int kGutter    = 1;
+
+    struct Placement {
+        int   page = -1;
+        QRect rect;            // Bereich auf der Seite (ohne Rand)
+    };
+
+    // Merkt sich nur Bild + Quellrechteck; gepackt wird in build()
+    int add(const QImage& image, const QRect& source);
+    int add(const QImage& image) { return add(image, image.rect()); }
+
+    void build();
+
+    int count() const { return int(m_items.size()); }
+    const QList<QImage>& pages() const { return m_pages; }
+    Placement placement(int index) const;
+
+private:
+    struct Item {
+        QImage    image;
+        QRect     source;
+        Placement placement;
+    };
+
+    static void blit(QImage& page, const Item& item, int gutter);
+
+    QList<Item>   m_items;
+    QList<QImage> m_pages;
+};
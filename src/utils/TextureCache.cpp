@@ -0,0 +1,421 @@
+#include "utils/TextureCache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+namespace {
+
+// ------------------------------------------------------------
+// Dateiformat (native Byte-Reihenfolge, Marker prüft sie)
+// ------------------------------------------------------------
+//  Header (64 Byte) | Pixelblöcke (je 16-Byte-aligned) | Index
+//
+//  Index pro Eintrag:
+//    quint32 pathBytes, UTF-8-Pfad (auf 4 Byte aufgefüllt)
+//    qint64  mtime, size
+//    qint32  width, height, bytesPerLine
+//    quint32 sliceCount
+//    quint64 offset
+//    sliceCount × { qint32 tag, x, y, w, h }
+// ------------------------------------------------------------
+struct FileHeader {
+    char    magic[8];
+    quint32 version;
+    quint32 byteOrder;
+    quint32 entryCount;
+    quint32 reserved0;
+    quint64 indexOffset;
+    quint64 indexSize;
+    quint64 reserved1[3];
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader muss 64 Byte groß sein");
+
+constexpr char    kMagic[8]  = { 'F', 'L', 'Y', 'F', 'F', 'T', 'E', 'X' };
+constexpr quint32 kByteOrder = 0x01020304u;
+constexpr qint64  kAlignment = 16;
+
+std::atomic<bool> g_enabled { true };
+
+// Cache-Ordner pro Quellordner: gleicher Ordnername in verschiedenen
+// Clients darf sich nicht überschneiden
+QString cacheDirFor(const QString& absoluteSourceDir)
+{
+    const QString base = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (base.isEmpty())
+        return QString();
+
+    const QByteArray hash = QCryptographicHash::hash(absoluteSourceDir.toUtf8(),
+                                                     QCryptographicHash::Sha1).toHex();
+    return QDir(base).filePath(QStringLiteral("textures/") + QString::fromLatin1(hash));
+}
+
+qint64 alignUp(qint64 v)
+{
+    return (v + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+template <typename T>
+void append(QByteArray& out, const T& value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Lesen mit Grenzprüfung
+struct Reader {
+    const uchar* data;
+    qint64       size;
+    qint64       pos = 0;
+
+    template <typename T>
+    bool read(T& value)
+    {
+        if (size - pos < qint64(sizeof(T)))
+            return false;
+        std::memcpy(&value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool readBytes(qint64 n, const uchar*& out)
+    {
+        if (n < 0 || size - pos < n)
+            return false;
+        out = data + pos;
+        pos += n;
+        return true;
+    }
+};
+
+} // namespace
+
+struct TextureCache::Mapping
+{
+    QFile        file;
+    const uchar* data = nullptr;
+    qint64       size = 0;
+};
+
+TextureCache::TextureCache(const QString& dirPath, const QString& name)
+    : m_dirPath(QDir(dirPath).absolutePath())
+    , m_cacheDir(cacheDirFor(m_dirPath))
+    , m_name(name)
+{
+    if (enabled() && !m_cacheDir.isEmpty())
+        openLatest();
+}
+
+TextureCache::~TextureCache() = default;
+
+void TextureCache::setEnabled(bool enabled)
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool TextureCache::enabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+QString TextureCache::relativePath(const QFileInfo& source) const
+{
+    const QString abs = source.absoluteFilePath();
+    if (abs.size() > m_dirPath.size()
+        && abs.startsWith(m_dirPath)
+        && abs.at(m_dirPath.size()) == QLatin1Char('/'))
+        return abs.mid(m_dirPath.size() + 1);
+    return abs;
+}
+
+QString TextureCache::generationPath(quint64 generation) const
+{
+    return QDir(m_cacheDir).filePath(
+        QString("%1_cache.%2").arg(m_name).arg(generation));
+}
+
+QStringList TextureCache::generationFiles() const
+{
+    return QDir(m_cacheDir).entryList({ QString("%1_cache.*").arg(m_name) }, QDir::Files);
+}
+
+// ------------------------------------------------------------
+// Neueste gültige Generation mappen
+// ------------------------------------------------------------
+void TextureCache::openLatest()
+{
+    const QStringList files = generationFiles();
+
+    QList<quint64> generations;
+    for (const QString& f : files) {
+        bool ok = false;
+        const quint64 gen = f.section(QLatin1Char('.'), -1).toULongLong(&ok);
+        if (ok)
+            generations << gen;
+    }
+    std::sort(generations.begin(), generations.end(), std::greater<quint64>());
+
+    if (!generations.isEmpty())
+        m_generation = generations.front();
+
+    for (quint64 gen : generations)
+    {
+        auto mapping = std::make_shared<Mapping>();
+        mapping->file.setFileName(generationPath(gen));
+
+        if (!mapping->file.open(QIODevice::ReadOnly))
+            continue;
+
+        mapping->size = mapping->file.size();
+        mapping->data = mapping->file.map(0, mapping->size);
+        if (!mapping->data)
+            continue;
+
+        if (parseIndex(mapping->data, mapping->size)) {
+            m_mapping = std::move(mapping);
+            return;
+        }
+
+        qWarning() << "[TextureCache] Ungültige Cachedatei ignoriert:" << generationPath(gen);
+        m_index.clear();
+    }
+}
+
+bool TextureCache::parseIndex(const uchar* data, qint64 size)
+{
+    if (size < qint64(sizeof(FileHeader)))
+        return false;
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0
+        || header.version != kVersion
+        || header.byteOrder != kByteOrder
+        || header.indexOffset > quint64(size)
+        || header.indexSize > quint64(size) - header.indexOffset)
+        return false;
+
+    Reader r { data + header.indexOffset, qint64(header.indexSize) };
+    m_index.reserve(header.entryCount);
+
+    for (quint32 i = 0; i < header.entryCount; ++i)
+    {
+        quint32 pathBytes = 0;
+        const uchar* path = nullptr;
+        if (!r.read(pathBytes) || !r.readBytes((qint64(pathBytes) + 3) & ~qint64(3), path))
+            return false;
+
+        IndexEntry e;
+        quint32 sliceCount = 0;
+        if (!r.read(e.mtime) || !r.read(e.size)
+            || !r.read(e.width) || !r.read(e.height) || !r.read(e.bytesPerLine)
+            || !r.read(sliceCount) || !r.read(e.offset))
+            return false;
+
+        // Pixelblock muss vollständig in der Datei liegen
+        if (e.width <= 0 || e.height <= 0 || e.bytesPerLine < e.width * 4
+            || e.offset % 4 != 0
+            || e.offset > quint64(size)
+            || quint64(e.bytesPerLine) * quint64(e.height) > quint64(size) - e.offset)
+            return false;
+
+        e.slices.reserve(sliceCount);
+        for (quint32 s = 0; s < sliceCount; ++s) {
+            qint32 v[5];
+            for (qint32& x : v) {
+                if (!r.read(x))
+                    return false;
+            }
+            e.slices.append({ v[0], QRect(v[1], v[2], v[3], v[4]) });
+        }
+
+        m_index.insert(QString::fromUtf8(reinterpret_cast<const char*>(path), pathBytes), e);
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------
+// Lookup (thread-sicher, nur lesend)
+// ------------------------------------------------------------
+bool TextureCache::lookup(const QFileInfo& source, Texture& out) const
+{
+    if (!m_mapping || !enabled())
+        return false;
+
+    const auto it = m_index.constFind(relativePath(source));
+    if (it == m_index.cend())
+        return false;
+
+    const IndexEntry& e = it.value();
+    if (e.mtime != source.lastModified().toMSecsSinceEpoch() || e.size != source.size())
+        return false;
+
+    // Jede View hält das Mapping am Leben
+    auto* holder = new std::shared_ptr<Mapping>(m_mapping);
+    out.image = QImage(m_mapping->data + e.offset,
+                       e.width, e.height, e.bytesPerLine,
+                       QImage::Format_ARGB32_Premultiplied,
+                       [](void* info) { delete static_cast<std::shared_ptr<Mapping>*>(info); },
+                       holder);
+    out.slices = e.slices;
+    return true;
+}
+
+void TextureCache::keep(const QFileInfo& source)
+{
+    const QString rel = relativePath(source);
+    if (m_index.contains(rel))
+        m_kept.insert(rel);
+}
+
+void TextureCache::insert(const QFileInfo& source, const Texture& texture)
+{
+    if (texture.image.isNull())
+        return;
+
+    IndexEntry e;
+    e.mtime  = source.lastModified().toMSecsSinceEpoch();
+    e.size   = source.size();
+    e.slices = texture.slices;
+
+    const QString rel = relativePath(source);
+    m_inserted.insert(rel, e);
+    m_insertedImages.insert(rel, texture.image.convertToFormat(QImage::Format_ARGB32_Premultiplied));
+}
+
+// ------------------------------------------------------------
+// Neue Generation schreiben
+// ------------------------------------------------------------
+bool TextureCache::save()
+{
+    if (!enabled() || m_cacheDir.isEmpty())
+        return false;
+
+    // Unverändert: alle Einträge getroffen, nichts neu, nichts verwaist
+    if (m_inserted.isEmpty() && m_kept.size() == m_index.size())
+        return true;
+
+    struct OutEntry {
+        QString      path;
+        IndexEntry   meta;
+        const uchar* pixels = nullptr;
+        qint64       bytes  = 0;
+    };
+
+    QList<OutEntry> entries;
+    entries.reserve(m_kept.size() + m_inserted.size());
+
+    for (const QString& rel : std::as_const(m_kept)) {
+        const IndexEntry& e = m_index[rel];
+        entries.append({ rel, e, m_mapping->data + e.offset, qint64(e.bytesPerLine) * e.height });
+    }
+
+    for (auto it = m_inserted.cbegin(); it != m_inserted.cend(); ++it) {
+        const QImage& img = m_insertedImages[it.key()];
+        IndexEntry e = it.value();
+        e.width        = img.width();
+        e.height       = img.height();
+        e.bytesPerLine = int(img.bytesPerLine());
+        entries.append({ it.key(), e, img.constBits(), qint64(img.sizeInBytes()) });
+    }
+
+    // Offsets vorab berechnen → Header, Pixel und Index in einem Zug
+    qint64 pos = sizeof(FileHeader);
+    for (OutEntry& e : entries) {
+        pos = alignUp(pos);
+        e.meta.offset = quint64(pos);
+        pos += e.bytes;
+    }
+    const qint64 indexOffset = alignUp(pos);
+
+    QByteArray index;
+    for (const OutEntry& e : entries)
+    {
+        const QByteArray path = e.path.toUtf8();
+        append(index, quint32(path.size()));
+        index.append(path);
+        index.append(QByteArray((4 - path.size() % 4) % 4, '\0'));
+
+        append(index, e.meta.mtime);
+        append(index, e.meta.size);
+        append(index, e.meta.width);
+        append(index, e.meta.height);
+        append(index, e.meta.bytesPerLine);
+        append(index, quint32(e.meta.slices.size()));
+        append(index, e.meta.offset);
+
+        for (const Slice& s : e.meta.slices) {
+            append(index, s.tag);
+            append(index, qint32(s.rect.x()));
+            append(index, qint32(s.rect.y()));
+            append(index, qint32(s.rect.width()));
+            append(index, qint32(s.rect.height()));
+        }
+    }
+
+    FileHeader header {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version     = kVersion;
+    header.byteOrder   = kByteOrder;
+    header.entryCount  = quint32(entries.size());
+    header.indexOffset = quint64(indexOffset);
+    header.indexSize   = quint64(index.size());
+
+    const quint64 generation = m_generation + 1;
+    const QString path = generationPath(generation);
+
+    if (!QDir().mkpath(m_cacheDir)) {
+        qWarning() << "[TextureCache] Cache-Ordner konnte nicht angelegt werden:" << m_cacheDir;
+        return false;
+    }
+
+    QSaveFile out(path);
+    if (!out.open(QIODevice::WriteOnly)) {
+        qWarning() << "[TextureCache] Cache konnte nicht angelegt werden:" << path;
+        return false;
+    }
+
+    static const char zeros[kAlignment] = {};
+    qint64 written = out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const OutEntry& e : entries) {
+        written += out.write(zeros, qint64(e.meta.offset) - written);
+        written += out.write(reinterpret_cast<const char*>(e.pixels), e.bytes);
+    }
+    written += out.write(zeros, indexOffset - written);
+    out.write(index);
+
+    if (!out.commit()) {
+        qWarning() << "[TextureCache] Cache konnte nicht geschrieben werden:" << path;
+        return false;
+    }
+
+    // Ältere Generationen entfernen (gemappte evtl. erst beim nächsten Mal)
+    const QStringList files = generationFiles();
+    for (const QString& f : files) {
+        const QString full = QDir(m_cacheDir).filePath(f);
+        if (full != path)
+            QFile::remove(full);
+    }
+
+    m_generation = generation;
+
+    qInfo().noquote() << QString("[TextureCache] %1: %2 Treffer, %3 neu → %4")
+                             .arg(m_name)
+                             .arg(m_kept.size())
+                             .arg(m_inserted.size())
+                             .arg(path);
+    return true;
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <QString>
+#include <QImage>
+#include <QRect>
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <memory>
+
+class QFileInfo;
+
+// ------------------------------------------------------------
+// TextureCache – persistenter Cache dekodierter Texturen
+// ------------------------------------------------------------
+//  - Eine Cachedatei pro Ordner (Theme- bzw. Icon-Ordner), abgelegt
+//    unter QStandardPaths::CacheLocation/textures/<Hash des absoluten
+//    Ordnerpfads> – nie im (evtl. schreibgeschützten) Client-Ordner
+//  - Schlüssel: relativer Pfad + mtime + Dateigröße
+//  - Inhalt: fertig nachbearbeitete Pixel (ARGB32_Premultiplied)
+//    und optionale Teilrechtecke (z. B. ControlState-Slices)
+//  - Die Datei wird gemappt; Treffer sind QImages, die direkt in das
+//    Mapping zeigen (kein Dekodieren, keine Kopie)
+//
+//  Geschrieben wird immer eine neue Generation (<name>.<n>), nie über
+//  eine gemappte Datei; ältere Generationen werden danach gelöscht
+//  (schlägt das fehl, z. B. unter Windows bei noch lebenden Views,
+//  beim nächsten Mal).
+//
+//  Ablauf:
+//    TextureCache cache(dir, "theme");
+//    parallel:  cache.lookup(fi, tex)  (nur lesend, thread-sicher)
+//    seriell:   cache.keep(fi) bzw. cache.insert(fi, tex)
+//    zum Ende:  cache.save()
+// ------------------------------------------------------------
+class TextureCache
+{
+public:
+    struct Slice {
+        qint32 tag = 0;      // z. B. ControlState
+        QRect  rect;
+    };
+
+    struct Texture {
+        QImage       image;  // ARGB32_Premultiplied
+        QList<Slice> slices;
+    };
+
+    // Format-/Decoder-Version – bei Änderungen an Decoder oder
+    // Nachbearbeitung erhöhen, dann werden alte Caches ignoriert
+    static constexpr quint32 kVersion = 1;
+
+    TextureCache(const QString& dirPath, const QString& name);
+    ~TextureCache();
+
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    // Global abschaltbar (Benchmarks, Fehlersuche)
+    static void setEnabled(bool enabled);
+    static bool enabled();
+
+    bool lookup(const QFileInfo& source, Texture& out) const;
+
+    void keep(const QFileInfo& source);
+    void insert(const QFileInfo& source, const Texture& texture);
+
+    // Schreibt nur, wenn sich etwas geändert hat
+    bool save();
+
+    int hits() const   { return int(m_kept.size()); }
+    int misses() const { return int(m_inserted.size()); }
+
+private:
+    struct Mapping;
+
+    struct IndexEntry {
+        qint64       mtime  = 0;
+        qint64       size   = 0;
+        qint32       width  = 0;
+        qint32       height = 0;
+        qint32       bytesPerLine = 0;
+        quint64      offset = 0;
+        QList<Slice> slices;
+    };
+
+    QString relativePath(const QFileInfo& source) const;
+    QString generationPath(quint64 generation) const;
+    QStringList generationFiles() const;
+    void openLatest();
+    bool parseIndex(const uchar* data, qint64 size);
+
+    QString m_dirPath;
+    QString m_cacheDir;   // leer → kein beschreibbarer Cache-Ort
+    QString m_name;
+
+    std::shared_ptr<Mapping>   m_mapping;
+    quint64                    m_generation = 0;
+    QHash<QString, IndexEntry> m_index;
+
+    QSet<QString>              m_kept;
+    QHash<QString, IndexEntry> m_inserted;       // Metadaten (ohne offset)
+    QHash<QString, QImage>     m_insertedImages;
+};
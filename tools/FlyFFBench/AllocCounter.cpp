@@ -0,0 +1,86 @@
+#include "AllocCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<quint64> g_count { 0 };
+std::atomic<quint64> g_bytes { 0 };
+
+inline void record(std::size_t size)
+{
+    g_count.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+} // namespace
+
+namespace AllocCounter {
+
+Snapshot now()
+{
+    return { g_count.load(std::memory_order_relaxed),
+             g_bytes.load(std::memory_order_relaxed) };
+}
+
+#if defined(__GLIBC__)
+bool coversMalloc() { return true; }
+#else
+bool coversMalloc() { return false; }
+#endif
+
+} // namespace AllocCounter
+
+// ------------------------------------------------------------
+// glibc: malloc-Familie abfangen (__libc_* sind die Originale)
+// operator new läuft dann ebenfalls hierüber.
+// ------------------------------------------------------------
+#if defined(__GLIBC__)
+
+extern "C" {
+void* __libc_malloc(std::size_t);
+void* __libc_calloc(std::size_t, std::size_t);
+void* __libc_realloc(void*, std::size_t);
+
+void* malloc(std::size_t size)
+{
+    record(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(std::size_t n, std::size_t size)
+{
+    record(n * size);
+    return __libc_calloc(n, size);
+}
+
+void* realloc(void* p, std::size_t size)
+{
+    record(size);
+    return __libc_realloc(p, size);
+}
+} // extern "C"
+
+#else
+
+void* operator new(std::size_t size)
+{
+    record(size);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept               { std::free(p); }
+void operator delete[](void* p) noexcept             { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept  { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+#endif
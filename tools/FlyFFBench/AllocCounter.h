@@ -0,0 +1,29 @@
+#pragma once
+#include <QtGlobal>
+
+// ------------------------------------------------------------
+// AllocCounter – zählt Heap-Allokationen des Prozesses
+// ------------------------------------------------------------
+//  - unter glibc wird die malloc-Familie abgefangen; damit sind
+//    operator new und Qt-Container (QArrayData) erfasst
+//  - sonst werden nur operator new/delete global ersetzt
+// Nur für FlyFFBench gedacht, nicht in FlyFFCore linken.
+// ------------------------------------------------------------
+namespace AllocCounter {
+
+struct Snapshot {
+    quint64 count = 0;
+    quint64 bytes = 0;
+};
+
+Snapshot now();
+
+inline Snapshot delta(const Snapshot& before, const Snapshot& after)
+{
+    return { after.count - before.count, after.bytes - before.bytes };
+}
+
+// true, wenn auch malloc erfasst wird
+bool coversMalloc();
+
+} // namespace AllocCounter
@@ -0,0 +1,341 @@
+#include "KernelCheck.h"
+#include "utils/PixelKernels.h"
+#include "utils/ResourceUtils.h"
+
+#include <QImage>
+#include <QRandomGenerator>
+
+#include <algorithm>
+#include <vector>
+
+namespace KernelCheck {
+
+namespace {
+
+constexpr int    kMaxLength = 200;          // Zeilenlängen 0..199
+constexpr int    kMaxOffset = 4;            // Quelle/Ziel um 0..3 verschoben
+constexpr int    kGuard     = 8;            // Pixel hinter count
+constexpr QRgb   kSentinel  = 0xA5A5A5A5u;
+constexpr size_t kDstSize   = size_t(kMaxLength + kMaxOffset + kGuard);
+
+QString hex(QRgb v)
+{
+    return QStringLiteral("0x%1").arg(v, 8, 16, QLatin1Char('0'));
+}
+
+// Erste Abweichung zweier Zielpuffer; -1 = gleich
+int firstMismatch(const std::vector<QRgb>& expected, const std::vector<QRgb>& actual)
+{
+    const auto it = std::mismatch(expected.begin(), expected.end(), actual.begin());
+    return it.first == expected.end() ? -1 : int(it.first - expected.begin());
+}
+
+// ------------------------------------------------------------
+// TGA-Kodierung (nur für den Roundtrip)
+// ------------------------------------------------------------
+struct TgaFormat {
+    const char* name;
+    int type;       // 1 = Palette, 2 = Truecolor (RLE: +8)
+    int bpp;
+    int cmDepth;    // 0 = keine Palette
+    int cmFirst;
+};
+
+const TgaFormat kTgaFormats[] = {
+    { "bgr24",        2, 24, 0,  0 },
+    { "bgra32",       2, 32, 0,  0 },
+    { "index8/pal24", 1, 8,  24, 0 },
+    { "index8/pal32", 1, 8,  32, 5 },
+};
+
+constexpr int kTgaWidth    = 37;
+constexpr int kTgaHeight   = 11;
+constexpr int kPaletteSize = 48;
+
+void appendColor(std::vector<uchar>& out, QRgb c, int bytes)
+{
+    out.push_back(uchar(qBlue(c)));
+    out.push_back(uchar(qGreen(c)));
+    out.push_back(uchar(qRed(c)));
+    if (bytes == 4)
+        out.push_back(uchar(qAlpha(c)));
+}
+
+// Pakete laufen bewusst über Zeilengrenzen
+void appendRle(std::vector<uchar>& out, const std::vector<uchar>& pixels, int bytesPerPixel)
+{
+    const int count = int(pixels.size()) / bytesPerPixel;
+    auto same = [&](int a, int b) {
+        return std::equal(pixels.begin() + a * bytesPerPixel,
+                          pixels.begin() + (a + 1) * bytesPerPixel,
+                          pixels.begin() + b * bytesPerPixel);
+    };
+
+    int i = 0;
+    while (i < count)
+    {
+        int run = 1;
+        while (i + run < count && run < 128 && same(i, i + run))
+            ++run;
+
+        if (run >= 2) {
+            out.push_back(uchar(0x80 | (run - 1)));
+            out.insert(out.end(), pixels.begin() + i * bytesPerPixel,
+                       pixels.begin() + (i + 1) * bytesPerPixel);
+            i += run;
+            continue;
+        }
+
+        int raw = 1;
+        while (i + raw < count && raw < 128
+               && !(i + raw + 1 < count && same(i + raw, i + raw + 1)))
+            ++raw;
+
+        out.push_back(uchar(raw - 1));
+        out.insert(out.end(), pixels.begin() + i * bytesPerPixel,
+                   pixels.begin() + (i + raw) * bytesPerPixel);
+        i += raw;
+    }
+}
+
+std::vector<uchar> encodeTga(const TgaFormat& f, const std::vector<QRgb>& palette,
+                             const std::vector<int>& indices,
+                             bool rle, bool topDown, bool rightToLeft)
+{
+    const bool indexed = f.cmDepth != 0;
+    const int bytesPerPixel = f.bpp / 8;
+
+    std::vector<uchar> out(18, 0);
+    out[0]  = 3;                                    // ID-Feld, wird übersprungen
+    out[1]  = indexed ? 1 : 0;
+    out[2]  = uchar(rle ? f.type + 8 : f.type);
+    out[3]  = uchar(f.cmFirst & 0xFF);
+    out[4]  = uchar(f.cmFirst >> 8);
+    out[5]  = uchar(indexed ? kPaletteSize : 0);
+    out[6]  = 0;
+    out[7]  = uchar(f.cmDepth);
+    out[12] = uchar(kTgaWidth & 0xFF);
+    out[13] = uchar(kTgaWidth >> 8);
+    out[14] = uchar(kTgaHeight & 0xFF);
+    out[15] = uchar(kTgaHeight >> 8);
+    out[16] = uchar(f.bpp);
+    out[17] = uchar(((f.bpp == 32 || f.cmDepth == 32) ? 8 : 0)
+                    | (topDown ? 0x20 : 0) | (rightToLeft ? 0x10 : 0));
+
+    out.insert(out.end(), { 'F', 'l', 'y' });
+
+    if (indexed) {
+        for (QRgb c : palette)
+            appendColor(out, c, f.cmDepth / 8);
+    }
+
+    // Pixel in Dateireihenfolge
+    std::vector<uchar> pixels;
+    pixels.reserve(size_t(kTgaWidth) * kTgaHeight * bytesPerPixel);
+    for (int r = 0; r < kTgaHeight; ++r)
+    {
+        const int y = topDown ? r : kTgaHeight - 1 - r;
+        for (int i = 0; i < kTgaWidth; ++i)
+        {
+            const int x   = rightToLeft ? kTgaWidth - 1 - i : i;
+            const int idx = indices[size_t(y) * kTgaWidth + x];
+            if (indexed)
+                pixels.push_back(uchar(idx + f.cmFirst));
+            else
+                appendColor(pixels, palette[size_t(idx)], bytesPerPixel);
+        }
+    }
+
+    if (rle)
+        appendRle(out, pixels, bytesPerPixel);
+    else
+        out.insert(out.end(), pixels.begin(), pixels.end());
+
+    return out;
+}
+
+} // namespace
+
+// ------------------------------------------------------------
+// Kernels: jede ISA gegen Scalar
+// ------------------------------------------------------------
+bool pixelKernels(QString* failure)
+{
+    using PixelKernels::Isa;
+
+    QRandomGenerator rng(0x5EED);
+
+    std::vector<uchar> src(size_t(kMaxLength + kMaxOffset) * 4);
+    for (uchar& b : src)
+        b = uchar(rng.bounded(256));
+
+    // Magenta mit beliebigem Alpha, Beinahe-Magenta und Zufall gemischt
+    std::vector<QRgb> keyInput(size_t(kMaxLength + kMaxOffset));
+    for (QRgb& px : keyInput) {
+        const quint32 alpha = rng.bounded(256) << 24;
+        switch (rng.bounded(4)) {
+        case 0:  px = alpha | 0x00FF00FFu; break;
+        case 1:  px = alpha | 0x00FF00FEu; break;
+        default: px = rng.generate();      break;
+        }
+    }
+
+    const PixelKernels::Kernels& scalar = PixelKernels::kernels(Isa::Scalar);
+
+    std::vector<QRgb> expected(kDstSize);
+    std::vector<QRgb> actual(kDstSize);
+
+    for (Isa isa : { Isa::Sse2, Isa::Ssse3, Isa::Avx2 })
+    {
+        if (!PixelKernels::supported(isa))
+            continue;
+
+        const PixelKernels::Kernels& k = PixelKernels::kernels(isa);
+
+        auto check = [&](const char* kernel, int len, int srcOff, int dstOff) {
+            const int at = firstMismatch(expected, actual);
+            if (at < 0)
+                return true;
+
+            *failure = QStringLiteral("%1 [%2] Länge %3, Quelle +%4, Ziel +%5: "
+                                      "Pixel %6 erwartet %7, erhalten %8")
+                           .arg(QLatin1StringView(kernel),
+                                QLatin1StringView(PixelKernels::isaName(isa)))
+                           .arg(len).arg(srcOff).arg(dstOff)
+                           .arg(at - dstOff)
+                           .arg(hex(expected[size_t(at)]), hex(actual[size_t(at)]));
+            return false;
+        };
+
+        for (int len = 0; len < kMaxLength; ++len)
+        {
+            for (int srcOff = 0; srcOff < kMaxOffset; ++srcOff)
+            {
+                for (int dstOff = 0; dstOff < kMaxOffset; ++dstOff)
+                {
+                    std::fill(expected.begin(), expected.end(), kSentinel);
+                    std::fill(actual.begin(), actual.end(), kSentinel);
+                    scalar.bgr24ToArgb(src.data() + srcOff, expected.data() + dstOff, len);
+                    k.bgr24ToArgb(src.data() + srcOff, actual.data() + dstOff, len);
+                    if (!check("bgr24ToArgb", len, srcOff, dstOff))
+                        return false;
+
+                    std::fill(expected.begin(), expected.end(), kSentinel);
+                    std::fill(actual.begin(), actual.end(), kSentinel);
+                    scalar.bgra32ToArgb(src.data() + srcOff, expected.data() + dstOff, len);
+                    k.bgra32ToArgb(src.data() + srcOff, actual.data() + dstOff, len);
+                    if (!check("bgra32ToArgb", len, srcOff, dstOff))
+                        return false;
+                }
+
+                // keyMagenta arbeitet in-place, srcOff verschiebt die Eingabe
+                std::fill(expected.begin(), expected.end(), kSentinel);
+                std::copy(keyInput.begin() + srcOff, keyInput.begin() + srcOff + len,
+                          expected.begin() + srcOff);
+                actual = expected;
+                scalar.keyMagenta(expected.data() + srcOff, len);
+                k.keyMagenta(actual.data() + srcOff, len);
+                if (!check("keyMagenta", len, srcOff, srcOff))
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------
+// TGA: roh/RLE/Palette × Ursprung, plus Abschneiden
+// ------------------------------------------------------------
+bool tgaRoundTrip(QString* failure)
+{
+    QRandomGenerator rng(0x7CA);
+
+    for (const TgaFormat& f : kTgaFormats)
+    {
+        const bool hasAlpha = f.bpp == 32 || f.cmDepth == 32;
+
+        std::vector<QRgb> palette(kPaletteSize);
+        for (QRgb& c : palette)
+            c = qRgba(int(rng.bounded(256)), int(rng.bounded(256)), int(rng.bounded(256)),
+                      hasAlpha ? int(rng.bounded(256)) : 255);
+        palette[0] = qRgba(255, 0, 255, hasAlpha ? 128 : 255);
+
+        // Läufe 1..9 → RLE enthält Run- und Rohpakete
+        std::vector<int> indices;
+        indices.reserve(size_t(kTgaWidth) * kTgaHeight);
+        while (indices.size() < size_t(kTgaWidth) * kTgaHeight) {
+            const int idx = int(rng.bounded(kPaletteSize));
+            const int run = 1 + int(rng.bounded(9));
+            for (int i = 0; i < run && indices.size() < size_t(kTgaWidth) * kTgaHeight; ++i)
+                indices.push_back(idx);
+        }
+
+        for (int variant = 0; variant < 8; ++variant)
+        {
+            const bool rle         = variant & 1;
+            const bool topDown     = variant & 2;
+            const bool rightToLeft = variant & 4;
+
+            const QString label = QStringLiteral("%1 %2 %3%4")
+                                      .arg(QLatin1StringView(f.name),
+                                           rle ? QStringLiteral("RLE") : QStringLiteral("roh"),
+                                           topDown ? QStringLiteral("oben") : QStringLiteral("unten"),
+                                           rightToLeft ? QStringLiteral("/rechts") : QStringLiteral("/links"));
+
+            const std::vector<uchar> data = encodeTga(f, palette, indices, rle, topDown, rightToLeft);
+
+            const QImage img = ResourceUtils::detail::decodeTga(
+                data.data(), qint64(data.size()), false, label);
+
+            if (img.width() != kTgaWidth || img.height() != kTgaHeight
+                || img.format() != QImage::Format_ARGB32) {
+                *failure = QStringLiteral("TGA %1: Bild nicht dekodiert").arg(label);
+                return false;
+            }
+
+            for (int y = 0; y < kTgaHeight; ++y)
+            {
+                const QRgb* line = reinterpret_cast<const QRgb*>(img.constScanLine(y));
+                for (int x = 0; x < kTgaWidth; ++x)
+                {
+                    const QRgb want = palette[size_t(indices[size_t(y) * kTgaWidth + x])];
+                    if (line[x] != want) {
+                        *failure = QStringLiteral("TGA %1: Pixel (%2, %3) erwartet %4, erhalten %5")
+                                       .arg(label).arg(x).arg(y)
+                                       .arg(hex(want), hex(line[x]));
+                        return false;
+                    }
+                }
+            }
+
+            // Jeder Präfix ist unvollständig → Null-Bild, kein Überlesen.
+            // Exakt große Kopie, damit ASan Lesezugriffe dahinter meldet.
+            const QtMessageHandler previous =
+                qInstallMessageHandler([](QtMsgType, const QMessageLogContext&, const QString&) {});
+
+            bool truncatedOk = true;
+            size_t badLength = 0;
+            for (size_t len = 0; len < data.size() && truncatedOk; ++len)
+            {
+                const std::vector<uchar> prefix(data.begin(), data.begin() + len);
+                if (!ResourceUtils::detail::decodeTga(prefix.data(), qint64(len), false, label).isNull()) {
+                    truncatedOk = false;
+                    badLength = len;
+                }
+            }
+
+            qInstallMessageHandler(previous);
+
+            if (!truncatedOk) {
+                *failure = QStringLiteral("TGA %1: abgeschnitten auf %2 von %3 Bytes trotzdem dekodiert")
+                               .arg(label).arg(qulonglong(badLength)).arg(qulonglong(data.size()));
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace KernelCheck
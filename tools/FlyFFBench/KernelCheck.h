@@ -0,0 +1,21 @@
+#pragma once
+#include <QString>
+
+// ------------------------------------------------------------
+// KernelCheck – Korrektheitsprüfung vor der kernels-Stufe
+// ------------------------------------------------------------
+//  - pixelKernels: jede unterstützte ISA gegen die Scalar-Tabelle,
+//    Zeilenlängen 0..199, Quelle und Ziel auch unausgerichtet;
+//    Bytes hinter count müssen unangetastet bleiben
+//  - tgaRoundTrip: synthetisches Bild als 24/32-Bit und 8-Bit-
+//    Palette, jeweils roh und RLE, in allen vier Ursprüngen
+//    kodieren und mit decodeTga zurücklesen; jeder abgeschnittene
+//    Präfix muss ein Null-Bild liefern
+// Bei Fehler: false, failure beschreibt die erste Abweichung.
+// ------------------------------------------------------------
+namespace KernelCheck {
+
+bool pixelKernels(QString* failure);
+bool tgaRoundTrip(QString* failure);
+
+} // namespace KernelCheck
@@ -0,0 +1,208 @@
+#include "SyntheticData.h"
+#include "utils/EncodingUtils.h"
+
+#include <QDir>
+#include <QFile>
+#include <QRandomGenerator>
+#include <QDebug>
+
+namespace SyntheticData {
+
+namespace {
+
+// Verteilung der Control-Typen (grob wie im Originalclient)
+const char* const kControlTypes[] = {
+    "WTYPE_STATIC", "WTYPE_STATIC", "WTYPE_BUTTON", "WTYPE_BUTTON",
+    "WTYPE_TEXT",   "WTYPE_EDITCTRL", "WTYPE_CHECKBOX", "WTYPE_COMBOBOX",
+    "WTYPE_LISTBOX", "WTYPE_GROUPBOX", "WTYPE_TABCTRL", "WTYPE_CUSTOM"
+};
+
+const char* const kControlTextures[] = {
+    "", "", "ButtBench.tga", "ButtBench.tga",
+    "", "WndEditTile00.tga", "ButtCheck.tga", "WndEditTile00.tga",
+    "WndEditTile00.tga", "", "", ""
+};
+
+constexpr int kTypeCount = int(sizeof(kControlTypes) / sizeof(kControlTypes[0]));
+
+bool writeUtf16(const QString& path, const QString& text)
+{
+    // bestehende Dateien aus früheren Läufen nicht als Vorlage nehmen
+    QFile::remove(path);
+    EncodingUtils::TextFileWriter writer(path);
+    writer.open({ QStringConverter::Utf16LE, 2, "UTF-16 LE (Vorgabe):" });
+    writer.write(text);
+    return writer.commit();
+}
+
+bool writeUtf8(const QString& path, const QString& text)
+{
+    QFile::remove(path);
+    EncodingUtils::TextFileWriter writer(path);
+    writer.open();
+    writer.write(text);
+    return writer.commit();
+}
+
+} // namespace
+
+// ------------------------------------------------------------
+// TGA
+// ------------------------------------------------------------
+bool writeTga(const QString& path, int width, int height, quint32 seed, bool magentaBorder)
+{
+    QByteArray data(18 + width * height * 4, Qt::Uninitialized);
+    uchar* d = reinterpret_cast<uchar*>(data.data());
+
+    std::fill(d, d + 18, uchar(0));
+    d[2]  = 2;                      // unkomprimiert, TrueColor
+    d[12] = uchar(width & 0xFF);
+    d[13] = uchar(width >> 8);
+    d[14] = uchar(height & 0xFF);
+    d[15] = uchar(height >> 8);
+    d[16] = 32;
+    d[17] = 8;                      // 8 Alpha-Bits, Ursprung unten links
+
+    QRandomGenerator rng(seed);
+    uchar* px = d + 18;
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const bool border = magentaBorder &&
+                                (x == 0 || y == 0 || x == width - 1 || y == height - 1);
+            if (border) {
+                *px++ = 255; *px++ = 0; *px++ = 255; *px++ = 255;  // B G R A
+            } else {
+                const quint32 v = rng.generate();
+                *px++ = uchar(v);
+                *px++ = uchar(v >> 8);
+                *px++ = uchar(v >> 16);
+                *px++ = 255;
+            }
+        }
+    }
+
+    QFile f(path);
+    if (!f.open(QIODevice::WriteOnly))
+        return false;
+    return f.write(data) == data.size();
+}
+
+// ------------------------------------------------------------
+// Gesamter Datensatz
+// ------------------------------------------------------------
+bool generate(const QString& dir, const Options& opt, Files& out)
+{
+    QDir root(dir);
+    if (!root.mkpath("Theme/Default"))
+        return false;
+
+    QRandomGenerator rng(opt.seed);
+
+    const int perWindow = qMax(1, opt.controlsPerWindow);
+    const int windows   = qMax(1, (opt.controls + perWindow - 1) / perWindow);
+
+    QString inc;
+    QString defs;
+    QString txt;
+    QString tinc;
+    inc.reserve(qsizetype(opt.controls) * 160);
+
+    int textId = 0;
+    auto nextText = [&](const QString& content) {
+        const QString id = QString("IDS_RESDATA_INC_%1").arg(++textId, 6, 10, QChar('0'));
+        txt += id + '\t' + content + "\r\n";
+        return id;
+    };
+
+    int remaining = opt.controls;
+
+    for (int w = 0; w < windows; ++w)
+    {
+        const QString wndName = QString("APP_BENCH_%1").arg(w, 5, 10, QChar('0'));
+        const int wndW = 256 + int(rng.bounded(16)) * 16;
+        const int wndH = 192 + int(rng.bounded(16)) * 16;
+
+        const QString title = nextText(QString("Bench Window %1").arg(w));
+        const QString help  = nextText(QString("Help for %1").arg(wndName));
+
+        inc += QString("%1 \"WndTile00.tga\" \"\" 1 %2 %3 0x2410000 26\r\n")
+                   .arg(wndName).arg(wndW).arg(wndH);
+        inc += "{\r\n// Title String\r\n" + title + "\r\n}\r\n";
+        inc += "{\r\n// Help Key\r\n" + help + "\r\n}\r\n";
+        inc += "{\r\n";
+
+        defs += QString("#define %1 %2\r\n").arg(wndName).arg(100 + w);
+        tinc += "TID_" + wndName + "\r\n{\r\n";
+
+        const int count = qMin(perWindow, remaining);
+        remaining -= count;
+
+        for (int c = 0; c < count; ++c)
+        {
+            const int type = int(rng.bounded(kTypeCount));
+            const QString ctrlId = QString("WIDC_CTRL%1").arg(c, 3, 10, QChar('0'));
+
+            const int x  = 8 + int(rng.bounded(uint(qMax(1, wndW - 96))));
+            const int y  = 24 + int(rng.bounded(uint(qMax(1, wndH - 64))));
+            const int x1 = x + 24 + int(rng.bounded(64u));
+            const int y1 = y + 16 + int(rng.bounded(24u));
+
+            const QString ctrlTitle = nextText(QString("Control %1/%2").arg(w).arg(c));
+            const QString ctrlTip   = nextText(QString("Tooltip %1/%2").arg(w).arg(c));
+
+            inc += QString("    %1 %2 \"%3\" 0 %4 %5 %6 %7 0x220000 0 0 0 0 %8 %9 %10\r\n")
+                       .arg(QLatin1StringView(kControlTypes[type]), ctrlId,
+                            QLatin1StringView(kControlTextures[type]))
+                       .arg(x).arg(y).arg(x1).arg(y1)
+                       .arg(rng.bounded(256u)).arg(rng.bounded(256u)).arg(rng.bounded(256u));
+            inc += "    {\r\n    // Title String\r\n    " + ctrlTitle + "\r\n    }\r\n";
+            inc += "    {\r\n    // ToolTip\r\n    " + ctrlTip + "\r\n    }\r\n";
+
+            defs += QString("#define %1 %2\r\n").arg(ctrlId).arg(1000 + c);
+            tinc += "\t" + ctrlTitle + "\r\n\t" + ctrlTip + "\r\n";
+        }
+
+        inc  += "}\r\n\r\n";
+        tinc += "}\r\n";
+    }
+
+    out.resdataInc    = root.filePath("resdata.inc");
+    out.resdataH      = root.filePath("resdata.h");
+    out.textClientTxt = root.filePath("textclient.txt");
+    out.textClientInc = root.filePath("textclient.inc");
+    out.themeRoot     = root.filePath("Theme");
+    out.windows       = windows;
+    out.controls      = opt.controls;
+
+    if (!writeUtf16(out.resdataInc, inc) ||
+        !writeUtf8(out.resdataH, defs) ||
+        !writeUtf16(out.textClientTxt, txt) ||
+        !writeUtf16(out.textClientInc, tinc))
+        return false;
+
+    // --- Theme ---
+    const QDir theme(root.filePath("Theme/Default"));
+    bool ok = true;
+    quint32 seed = opt.seed;
+
+    for (int i = 0; i < 12; ++i)
+        ok &= writeTga(theme.filePath(QString("WndTile%1.tga").arg(i, 2, 10, QChar('0'))),
+                       32, 32, ++seed, false);
+    for (int i = 0; i < 9; ++i)
+        ok &= writeTga(theme.filePath(QString("WndEditTile%1.tga").arg(i, 2, 10, QChar('0'))),
+                       8, 8, ++seed, false);
+
+    // Strips: Breite >= 4 × Höhe → werden in States zerlegt
+    ok &= writeTga(theme.filePath("ButtBench.tga"), 4 * 96, 24, ++seed, true);
+    ok &= writeTga(theme.filePath("ButtCheck.tga"), 6 * 16, 16, ++seed, true);
+
+    // Ein paar große Texturen für realistischen Dekodieraufwand
+    for (int i = 0; i < 8; ++i)
+        ok &= writeTga(theme.filePath(QString("WndBench%1.tga").arg(i, 2, 10, QChar('0'))),
+                       256, 256, ++seed, true);
+
+    return ok;
+}
+
+} // namespace SyntheticData
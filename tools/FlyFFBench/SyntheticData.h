@@ -0,0 +1,37 @@
+#pragma once
+#include <QString>
+
+// ------------------------------------------------------------
+// SyntheticData – erzeugt einen künstlichen FlyFF-Client
+// ------------------------------------------------------------
+//  - resdata.inc (UTF-16 LE mit BOM, wie die Originaldatei)
+//  - resdata.h, textclient.txt, textclient.inc
+//  - Theme/Default mit TGA-Texturen (Fenster-Tileset, Button-
+//    Strips, Edit-Tiles) inkl. Magenta-Maske
+// Inhalt ist deterministisch (fester Seed), damit Läufe
+// vergleichbar bleiben.
+// ------------------------------------------------------------
+namespace SyntheticData {
+
+struct Options {
+    int controls          = 1000;  // Gesamtzahl Controls
+    int controlsPerWindow = 20;
+    quint32 seed          = 0x5EED;
+};
+
+struct Files {
+    QString resdataInc;
+    QString resdataH;
+    QString textClientTxt;
+    QString textClientInc;
+    QString themeRoot;     // enthält Default/
+    int windows  = 0;
+    int controls = 0;
+};
+
+bool generate(const QString& dir, const Options& opt, Files& out);
+
+// Unkomprimierte 32-bit TGA (Bottom-up, BGRA) schreiben
+bool writeTga(const QString& path, int width, int height, quint32 seed, bool magentaBorder);
+
+} // namespace SyntheticData
@@ -0,0 +1,399 @@
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QImage>
+#include <QPainter>
+#include <QFile>
+#include <QDebug>
+
+#include "core/ConfigManager.h"
+#include "core/FileManager.h"
+#include "define/DefineBackend.h"
+#include "define/DefineManager.h"
+#include "define/FlagManager.h"
+#include "text/TextBackend.h"
+#include "text/TextManager.h"
+#include "layout/LayoutParser.h"
+#include "layout/LayoutBackend.h"
+#include "layout/LayoutManager.h"
+#include "layout/LayoutEngine.h"
+#include "render/RenderManager.h"
+#include "theme/ThemeManager.h"
+#include "behavior/BehaviorManager.h"
+#include "utils/PixelKernels.h"
+#include "utils/TextureCache.h"
+
+#include "AllocCounter.h"
+#include "KernelCheck.h"
+#include "SyntheticData.h"
+
+#include <limits>
+#include <vector>
+
+// ------------------------------------------------------------
+// FlyFFBench – Stufenweise Benchmarks auf synthetischen Daten
+// ------------------------------------------------------------
+//  Stufen (einzeln wählbar über --stages):
+//   tokenize  LayoutParser::parse
+//   refresh   LayoutManager::refreshFromParser
+//   behavior  BehaviorManager::resolveBehavior (alle Fenster/Controls)
+//   apply     Define-/Text-Dateien laden + anwenden
+//   theme     ThemeManager::loadTheme (kalt = ohne TextureCache, warm = gecacht)
+//   layout    LayoutEngine::computeWindowLayout (alle Fenster)
+//   render    RenderManager::render in ein QImage (kalt = Fenster-Cache
+//             und Theme-Render-Caches verworfen, warm = Blit aus dem
+//             Fenster-Cache)
+//   save      serializeLayout (kalt = Cache verworfen, warm = gecacht)
+//   kernels   PixelKernels (TGA-Zeilen 24/32-Bit + Magenta-Key) je ISA;
+//             vorher Abgleich gegen Scalar und TGA-Roundtrip (KernelCheck),
+//             bei Abweichung Abbruch mit Exit-Code 3
+//
+//  Ausgabe: ein JSON-Dokument (stdout oder --json) mit Laufzeit,
+//  Durchsatz und Allokationen pro Stufe.
+// ------------------------------------------------------------
+
+namespace {
+
+bool g_verbose = false;
+
+struct StageResult {
+    QString name;
+    int     iterations = 0;
+    qint64  items = 0;         // verarbeitete Einheiten pro Iteration
+    QString unit;
+    std::vector<qint64> nsecs; // pro Iteration
+    AllocCounter::Snapshot allocs;
+
+    QJsonObject toJson() const
+    {
+        qint64 total = 0;
+        qint64 best  = std::numeric_limits<qint64>::max();
+        for (qint64 n : nsecs) {
+            total += n;
+            best = qMin(best, n);
+        }
+        const double mean = nsecs.empty() ? 0.0 : double(total) / double(nsecs.size());
+
+        QJsonObject o;
+        o["name"]          = name;
+        o["iterations"]    = iterations;
+        o["items"]         = double(items);
+        o["unit"]          = unit;
+        o["ns_mean"]       = mean;
+        o["ns_min"]        = nsecs.empty() ? 0.0 : double(best);
+        o["items_per_sec"] = mean > 0 ? double(items) * 1.0e9 / mean : 0.0;
+        o["allocs_per_iter"] = iterations ? double(allocs.count) / iterations : 0.0;
+        o["alloc_bytes_per_iter"] = iterations ? double(allocs.bytes) / iterations : 0.0;
+        return o;
+    }
+};
+
+template <typename Fn>
+StageResult measure(const QString& name, int iterations, qint64 items,
+                    const QString& unit, Fn&& fn)
+{
+    StageResult r;
+    r.name       = name;
+    r.iterations = iterations;
+    r.items      = items;
+    r.unit       = unit;
+
+    // Aufwärmen (Caches, Lazy-Init) – nicht gezählt
+    fn();
+
+    const AllocCounter::Snapshot before = AllocCounter::now();
+    for (int i = 0; i < iterations; ++i) {
+        QElapsedTimer timer;
+        timer.start();
+        fn();
+        r.nsecs.push_back(timer.nsecsElapsed());
+    }
+    r.allocs = AllocCounter::delta(before, AllocCounter::now());
+
+    qInfo().noquote() << QString("[FlyFFBench] %1: %2 ms/iter")
+                             .arg(name, -9)
+                             .arg(r.toJson()["ns_mean"].toDouble() / 1.0e6, 0, 'f', 3);
+    return r;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    // Kein Fenster nötig – offscreen reicht für QPixmap/QPainter
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QGuiApplication app(argc, argv);
+    app.setApplicationName("FlyFFBench");
+
+    QCommandLineParser cli;
+    cli.setApplicationDescription("Benchmarks für Parse-, Layout-, Render- und Speicherpfad");
+    cli.addHelpOption();
+
+    const QCommandLineOption controlsOpt({ "n", "controls" }, "Anzahl Controls (z. B. 1000, 10000, 50000)", "n", "1000");
+    const QCommandLineOption perWndOpt("per-window", "Controls pro Fenster", "n", "20");
+    const QCommandLineOption iterOpt({ "i", "iterations" }, "Iterationen pro Stufe", "n", "5");
+    const QCommandLineOption stagesOpt("stages", "Kommagetrennte Stufenliste", "list",
+                                       "tokenize,refresh,behavior,apply,theme,layout,render,save,kernels");
+    const QCommandLineOption renderOpt("render-windows", "Anzahl gerenderter Fenster pro Iteration", "n", "50");
+    const QCommandLineOption dirOpt("workdir", "Verzeichnis für die synthetischen Daten (Standard: temporär)", "dir");
+    const QCommandLineOption jsonOpt("json", "Ergebnis zusätzlich in Datei schreiben", "file");
+    const QCommandLineOption verboseOpt({ "v", "verbose" }, "Logausgaben der Manager anzeigen");
+
+    cli.addOptions({ controlsOpt, perWndOpt, iterOpt, stagesOpt, renderOpt,
+                     dirOpt, jsonOpt, verboseOpt });
+    cli.process(app);
+
+    g_verbose = cli.isSet(verboseOpt);
+
+    qInstallMessageHandler([](QtMsgType type, const QMessageLogContext& ctx, const QString& msg) {
+        Q_UNUSED(ctx);
+        if (!g_verbose && type == QtDebugMsg)
+            return;
+        if (!g_verbose && type == QtInfoMsg && !msg.startsWith("[FlyFFBench]"))
+            return;
+
+        QByteArray localMsg = msg.toLocal8Bit();
+        fprintf(stderr, "%s\n", localMsg.constData());
+    });
+
+    const QStringList stages = cli.value(stagesOpt).split(',', Qt::SkipEmptyParts);
+    auto wants = [&stages](const char* s) { return stages.contains(QLatin1StringView(s)); };
+
+    const int iterations = qMax(1, cli.value(iterOpt).toInt());
+
+    // ---------------------------------------------------
+    // Synthetische Daten
+    // ---------------------------------------------------
+    QTemporaryDir tempDir;
+    const QString workDir = cli.isSet(dirOpt) ? cli.value(dirOpt) : tempDir.path();
+
+    SyntheticData::Options opt;
+    opt.controls          = qMax(1, cli.value(controlsOpt).toInt());
+    opt.controlsPerWindow = qMax(1, cli.value(perWndOpt).toInt());
+
+    SyntheticData::Files files;
+    QElapsedTimer genTimer;
+    genTimer.start();
+    if (!SyntheticData::generate(workDir, opt, files)) {
+        qWarning() << "[FlyFFBench] Konnte synthetische Daten nicht erzeugen in" << workDir;
+        return 2;
+    }
+    qInfo().noquote() << QString("[FlyFFBench] Daten erzeugt: %1 Fenster, %2 Controls (%3 ms)")
+                             .arg(files.windows).arg(files.controls).arg(genTimer.elapsed());
+
+    // ---------------------------------------------------
+    // Manager wie im ProjectController verdrahten
+    // ---------------------------------------------------
+    ConfigManager config;
+    config.setLayoutPath(files.resdataInc);
+    config.setThemePath(files.themeRoot);
+
+    FileManager   fileManager(&config);
+    fileManager.cacheLayoutPath(files.resdataInc);
+
+    LayoutParser  parser;
+    LayoutBackend layoutBackend(fileManager, parser);
+    DefineManager defineManager;
+    DefineBackend defineBackend;
+    FlagManager   flagManager(&config);
+    TextManager   textManager;
+    TextBackend   textBackend;
+    LayoutManager layoutManager(parser, layoutBackend);
+    ThemeManager  themeManager(&fileManager);
+
+    BehaviorManager behaviorManager(&flagManager, &textManager, &defineManager,
+                                    &layoutManager, &layoutBackend);
+    layoutManager.setBehaviorManager(&behaviorManager);
+
+    LayoutEngine  layoutEngine(&themeManager, &behaviorManager);
+    RenderManager renderManager(&themeManager, &behaviorManager);
+
+    // Basiszustand für Stufen, die auf vorherigen aufbauen
+    parser.parse(files.resdataInc);
+    layoutManager.refreshFromParser();
+    layoutManager.processLayout();
+    themeManager.loadTheme("Default");
+
+    const auto& windows = layoutManager.processedWindows();
+    const QSize canvasSize(1024, 768);
+
+    std::vector<StageResult> results;
+
+    if (wants("tokenize")) {
+        results.push_back(measure("tokenize", iterations, files.controls, "controls", [&] {
+            parser.parse(files.resdataInc);
+        }));
+    }
+
+    if (wants("refresh")) {
+        results.push_back(measure("refresh", iterations, files.controls, "controls", [&] {
+            layoutManager.refreshFromParser();
+        }));
+        layoutManager.processLayout();
+    }
+
+    if (wants("behavior")) {
+        results.push_back(measure("behavior", iterations, files.controls + files.windows, "objects", [&] {
+            for (const auto& wnd : windows) {
+                wnd->behavior = behaviorManager.resolveBehavior(*wnd);
+                for (const auto& ctrl : wnd->controls)
+                    ctrl->behavior = behaviorManager.resolveBehavior(*ctrl);
+            }
+        }));
+    }
+
+    if (wants("apply")) {
+        results.push_back(measure("apply", iterations, files.controls, "controls", [&] {
+            defineBackend.load(files.resdataH, defineManager);
+            textBackend.loadText(files.textClientTxt, textManager);
+            textBackend.loadInc(files.textClientInc, textManager);
+            defineManager.applyDefinesToLayout(windows);
+            textManager.applyTextsToLayout(windows);
+        }));
+    }
+
+    if (wants("theme")) {
+        // kalt = ohne TextureCache (volles Dekodieren), warm = aus dem Cache
+        TextureCache::setEnabled(false);
+        results.push_back(measure("theme-cold", iterations, 1, "themes", [&] {
+            themeManager.loadTheme("Default");
+        }));
+        TextureCache::setEnabled(true);
+        themeManager.loadTheme("Default");
+
+        results.push_back(measure("theme-warm", iterations, 1, "themes", [&] {
+            themeManager.loadTheme("Default");
+        }));
+    }
+
+    if (wants("layout")) {
+        results.push_back(measure("layout", iterations, qint64(windows.size()), "windows", [&] {
+            for (const auto& wnd : windows)
+                layoutEngine.computeWindowLayout(wnd, canvasSize);
+        }));
+    }
+
+    if (wants("render")) {
+        const int count = qMin<int>(cli.value(renderOpt).toInt(), int(windows.size()));
+        QImage target(canvasSize, QImage::Format_ARGB32_Premultiplied);
+
+        // kalt: alle Render-Caches leer (Fensterbild, Skins, Slices, skalierte Texturen)
+        results.push_back(measure("render-cold", iterations, count, "windows", [&] {
+            renderManager.clearCache();
+            themeManager.clearRenderCaches();
+            QPainter painter(&target);
+            for (int i = 0; i < count; ++i)
+                renderManager.render(&painter, windows[i], canvasSize);
+        }));
+        results.push_back(measure("render-warm", iterations, count, "windows", [&] {
+            QPainter painter(&target);
+            for (int i = 0; i < count; ++i)
+                renderManager.render(&painter, windows[i], canvasSize);
+        }));
+    }
+
+    if (wants("save")) {
+        results.push_back(measure("save-cold", iterations, files.controls, "controls", [&] {
+            layoutManager.markAllDirty();
+            layoutManager.serializeLayout();
+        }));
+        results.push_back(measure("save-warm", iterations, files.controls, "controls", [&] {
+            if (!windows.empty())
+                layoutManager.markWindowDirty(windows.front());
+            layoutManager.serializeLayout();
+        }));
+    }
+
+    if (wants("kernels")) {
+        QString failure;
+        if (!KernelCheck::pixelKernels(&failure) || !KernelCheck::tgaRoundTrip(&failure)) {
+            qWarning().noquote() << "[FlyFFBench] kernels: Prüfung fehlgeschlagen –" << failure;
+            return 3;
+        }
+        qInfo() << "[FlyFFBench] kernels: Scalar-Abgleich und TGA-Roundtrip ok";
+
+        // 1024×1024 Pixel, zeilenweise wie im TGA-Decoder; jedes 7. Pixel Magenta
+        constexpr int kWidth  = 1024;
+        constexpr int kHeight = 1024;
+        constexpr qint64 kPixels = qint64(kWidth) * kHeight;
+
+        std::vector<uchar> src24(size_t(kPixels) * 3);
+        std::vector<uchar> src32(size_t(kPixels) * 4);
+        std::vector<QRgb>  dst(size_t(kPixels));
+
+        for (qint64 i = 0; i < kPixels; ++i) {
+            const bool magenta = i % 7 == 0;
+            const uchar b = magenta ? 255 : uchar(i * 13);
+            const uchar g = magenta ? 0   : uchar(i * 7);
+            const uchar r = magenta ? 255 : uchar(i * 3);
+            src24[size_t(i) * 3 + 0] = b;
+            src24[size_t(i) * 3 + 1] = g;
+            src24[size_t(i) * 3 + 2] = r;
+            src32[size_t(i) * 4 + 0] = b;
+            src32[size_t(i) * 4 + 1] = g;
+            src32[size_t(i) * 4 + 2] = r;
+            src32[size_t(i) * 4 + 3] = uchar(i);
+        }
+
+        using PixelKernels::Isa;
+        for (Isa isa : { Isa::Scalar, Isa::Sse2, Isa::Ssse3, Isa::Avx2 }) {
+            if (!PixelKernels::supported(isa))
+                continue;
+
+            const PixelKernels::Kernels& k = PixelKernels::kernels(isa);
+            const QString suffix = QString::fromLatin1(PixelKernels::isaName(isa));
+
+            results.push_back(measure("tga24-" + suffix, iterations, kPixels, "pixels", [&] {
+                for (int y = 0; y < kHeight; ++y) {
+                    QRgb* line = dst.data() + size_t(y) * kWidth;
+                    k.bgr24ToArgb(src24.data() + size_t(y) * kWidth * 3, line, kWidth);
+                    k.keyMagenta(line, kWidth);
+                }
+            }));
+
+            results.push_back(measure("tga32-" + suffix, iterations, kPixels, "pixels", [&] {
+                for (int y = 0; y < kHeight; ++y) {
+                    QRgb* line = dst.data() + size_t(y) * kWidth;
+                    k.bgra32ToArgb(src32.data() + size_t(y) * kWidth * 4, line, kWidth);
+                    k.keyMagenta(line, kWidth);
+                }
+            }));
+        }
+    }
+
+    // ---------------------------------------------------
+    // Ergebnis
+    // ---------------------------------------------------
+    QJsonArray stageArray;
+    for (const StageResult& r : results)
+        stageArray.append(r.toJson());
+
+    QJsonObject doc;
+    doc["benchmark"]     = "FlyFFBench";
+    doc["qt"]            = QString::fromLatin1(qVersion());
+    doc["controls"]      = files.controls;
+    doc["windows"]       = files.windows;
+    doc["iterations"]    = iterations;
+    doc["malloc_counted"] = AllocCounter::coversMalloc();
+    doc["pixel_isa"]     = QString::fromLatin1(PixelKernels::isaName(PixelKernels::activeIsa()));
+    doc["stages"]        = stageArray;
+
+    const QByteArray json = QJsonDocument(doc).toJson(QJsonDocument::Indented);
+    fwrite(json.constData(), 1, size_t(json.size()), stdout);
+
+    if (cli.isSet(jsonOpt)) {
+        QFile f(cli.value(jsonOpt));
+        if (!f.open(QIODevice::WriteOnly) || f.write(json) != json.size()) {
+            qWarning() << "[FlyFFBench] Konnte Ergebnis nicht schreiben:" << cli.value(jsonOpt);
+            return 1;
+        }
+    }
+
+    return 0;
+}
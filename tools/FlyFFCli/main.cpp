@@ -0,0 +1,208 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QDebug>
+
+#include "core/ConfigManager.h"
+#include "core/FileManager.h"
+#include "define/DefineBackend.h"
+#include "define/DefineManager.h"
+#include "define/FlagManager.h"
+#include "text/TextBackend.h"
+#include "text/TextManager.h"
+#include "layout/LayoutParser.h"
+#include "layout/LayoutBackend.h"
+#include "layout/LayoutManager.h"
+#include "layout/model/TokenData.h"
+#include "behavior/BehaviorManager.h"
+#include "utils/EncodingUtils.h"
+
+#include <vector>
+
+// ------------------------------------------------------------
+// FlyFFCli – Headless-Pipeline für den Build
+// ------------------------------------------------------------
+//  parse → refresh → process → defines/texte → serialize
+//  Gleiche Reihenfolge wie ProjectController::loadProject,
+//  aber ohne QtWidgets, Dialoge und Theme/Render-Teil.
+//  Pro Stufe wird die Laufzeit ausgegeben.
+// ------------------------------------------------------------
+
+namespace {
+
+bool g_verbose = false;
+
+struct StageTiming {
+    QString name;
+    qint64  nsecs = 0;
+};
+
+class StageClock
+{
+public:
+    template <typename Fn>
+    bool run(const QString& name, Fn&& fn)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        const bool ok = fn();
+        m_stages.push_back({ name, timer.nsecsElapsed() });
+        return ok;
+    }
+
+    void print(QTextStream& out) const
+    {
+        qint64 total = 0;
+        for (const StageTiming& s : m_stages) {
+            out << QString("%1 %2 ms\n").arg(s.name, -12).arg(s.nsecs / 1.0e6, 10, 'f', 2);
+            total += s.nsecs;
+        }
+        out << QString("%1 %2 ms\n").arg(QStringLiteral("total"), -12).arg(total / 1.0e6, 10, 'f', 2);
+    }
+
+private:
+    std::vector<StageTiming> m_stages;
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName("FlyFFCli");
+
+    QCommandLineParser cli;
+    cli.setApplicationDescription("Headless Layout-Pipeline (resdata.inc laden, prüfen, neu schreiben)");
+    cli.addHelpOption();
+
+    const QCommandLineOption configOpt({ "c", "config" }, "config.ini (Standard: neben der Anwendung)", "ini");
+    const QCommandLineOption layoutOpt({ "l", "layout" }, "resdata.inc (überschreibt config.ini)", "file");
+    const QCommandLineOption defineOpt("define",   "resdata.h (Standard: Suche neben dem Layout)", "file");
+    const QCommandLineOption textOpt("text",       "textClient.txt (Standard: Suche neben dem Layout)", "file");
+    const QCommandLineOption textIncOpt("text-inc", "textClient.inc (Standard: Suche neben dem Layout)", "file");
+    const QCommandLineOption outputOpt({ "o", "output" }, "Serialisiertes Layout schreiben", "file");
+    const QCommandLineOption serialOpt("serial",   "Fensteraufbau ohne QtConcurrent");
+    const QCommandLineOption verboseOpt({ "v", "verbose" }, "Logausgaben der Manager anzeigen");
+
+    cli.addOptions({ configOpt, layoutOpt, defineOpt, textOpt, textIncOpt,
+                     outputOpt, serialOpt, verboseOpt });
+    cli.process(app);
+
+    g_verbose = cli.isSet(verboseOpt);
+
+    qInstallMessageHandler([](QtMsgType type, const QMessageLogContext& ctx, const QString& msg) {
+        Q_UNUSED(ctx);
+        if (!g_verbose && (type == QtDebugMsg || type == QtInfoMsg))
+            return;
+
+        QByteArray localMsg = msg.toLocal8Bit();
+        fprintf(stderr, "%s\n", localMsg.constData());
+    });
+
+    QTextStream out(stdout);
+
+    // ---------------------------------------------------
+    // Pfade: Argumente vor config.ini
+    // ---------------------------------------------------
+    ConfigManager config;
+    const QString cfgFile = cli.isSet(configOpt) ? cli.value(configOpt)
+                                                 : ConfigManager::defaultConfigPath();
+    if (QFileInfo::exists(cfgFile) && !config.load(cfgFile)) {
+        qWarning() << "[FlyFFCli] Konnte Config nicht laden:" << cfgFile;
+        return 2;
+    }
+    if (cli.isSet(layoutOpt))
+        config.setLayoutPath(cli.value(layoutOpt));
+
+    const QString resdataFile = config.layoutPath();
+    if (resdataFile.isEmpty() || !QFileInfo::exists(resdataFile)) {
+        qWarning() << "[FlyFFCli] Keine Layout-Datei (--layout oder config.ini):" << resdataFile;
+        return 2;
+    }
+
+    FileManager files(&config);
+    files.cacheLayoutPath(resdataFile);
+
+    const QString defineFile  = cli.isSet(defineOpt)  ? cli.value(defineOpt)  : files.findDefineFile(resdataFile);
+    const QString textFile    = cli.isSet(textOpt)    ? cli.value(textOpt)    : files.findTextFile(resdataFile);
+    const QString textIncFile = cli.isSet(textIncOpt) ? cli.value(textIncOpt) : files.findTextIncFile(resdataFile);
+
+    // ---------------------------------------------------
+    // Manager wie im ProjectController verdrahten
+    // ---------------------------------------------------
+    LayoutParser  parser;
+    LayoutBackend layoutBackend(files, parser);
+    DefineManager defineManager;
+    DefineBackend defineBackend;
+    FlagManager   flagManager(&config);
+    TextManager   textManager;
+    TextBackend   textBackend;
+    LayoutManager layoutManager(parser, layoutBackend);
+
+    BehaviorManager behaviorManager(&flagManager, &textManager, &defineManager,
+                                    &layoutManager, &layoutBackend);
+    layoutManager.setBehaviorManager(&behaviorManager);
+    layoutManager.setParallelRefresh(!cli.isSet(serialOpt));
+
+    StageClock clock;
+
+    const bool ok =
+        clock.run("flags", [&] {
+            behaviorManager.refreshFlagsFromFiles();
+            return true;
+        })
+        && clock.run("parse", [&] {
+            return parser.parse(resdataFile);
+        })
+        && clock.run("rebuild", [&] {
+            const TokenSnapshot snapshot = TokenData::instance().snapshot();
+            defineManager.rebuildFromTokens(*snapshot);
+            textManager.rebuildFromTokens(*snapshot);
+            return true;
+        })
+        && clock.run("refresh", [&] {
+            layoutManager.refreshFromParser();
+            return true;
+        })
+        && clock.run("process", [&] {
+            layoutManager.processLayout();
+            return true;
+        })
+        && clock.run("load-defs", [&] {
+            if (!defineFile.isEmpty())
+                defineBackend.load(defineFile, defineManager);
+            if (!textFile.isEmpty())
+                textBackend.loadText(textFile, textManager);
+            if (!textIncFile.isEmpty())
+                textBackend.loadInc(textIncFile, textManager);
+            return true;
+        })
+        && clock.run("apply", [&] {
+            const auto& windows = layoutManager.processedWindows();
+            defineManager.applyDefinesToLayout(windows);
+            textManager.applyTextsToLayout(windows);
+            return true;
+        })
+        && clock.run("serialize", [&] {
+            if (!cli.isSet(outputOpt))
+                return !layoutManager.serializeLayout().isEmpty();
+
+            EncodingUtils::TextFileWriter writer(cli.value(outputOpt));
+            writer.open({ QStringConverter::Utf16LE, 2, "UTF-16 LE (Vorgabe):" });
+            layoutManager.writeLayout(writer);
+            return writer.commit();
+        });
+
+    out << "windows     " << layoutManager.processedWindows().size() << "\n";
+    clock.print(out);
+    out.flush();
+
+    if (!ok) {
+        qWarning() << "[FlyFFCli] Pipeline abgebrochen.";
+        return 1;
+    }
+
+    return 0;
+}